@@ -0,0 +1,32 @@
+#ifndef BENCH_HPP
+#define BENCH_HPP
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+#include <iostream>
+#include <string_view>
+
+namespace bench {
+    /// Runs `func` `iterations` times and prints the average time per run.
+    template <std::invocable Func>
+    void run(std::string_view name, Func func, const int iterations = 5) {
+        std::uint64_t sink = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i)
+            sink += static_cast<std::uint64_t>(func());
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        std::cout << name << ": " << elapsed.count() / iterations << " ms (" << sink / iterations << ")\n";
+    }
+
+    /// Small deterministic generator so every benchmark sees the same input.
+    struct lcg {
+        std::uint64_t state = 0x853C49E6748FEA9BULL;
+
+        std::uint32_t operator()() noexcept {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            return static_cast<std::uint32_t>(state >> 33);
+        }
+    };
+}   // namespace bench
+
+#endif  // BENCH_HPP
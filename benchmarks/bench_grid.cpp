@@ -0,0 +1,74 @@
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "aoc.hpp"
+#include "bench.hpp"
+
+using namespace aoc;
+
+namespace {
+    constexpr std::size_t size = 2048;
+
+    template <typename Layout>
+    grid<char, Layout> make_maze() {
+        grid<char, Layout> result{size, size, '.'};
+        bench::lcg rng;
+        for (std::size_t y = 0; y < size; ++y)
+            for (std::size_t x = 0; x < size; ++x)
+                if (rng() % 4 == 0)
+                    result.at(x, y) = '#';
+        result.at(0, 0) = '.';
+        return result;
+    }
+
+    template <typename Layout>
+    std::size_t bfs(const grid<char, Layout>& maze) {
+        grid<unsigned, Layout> dist{maze.width(), maze.height(), ~0U};
+        std::vector<pos<std::size_t>> frontier{pos<std::size_t>{0}};
+        std::vector<pos<std::size_t>> next;
+        std::size_t reached = 1;
+        dist.at(0, 0) = 0;
+        for (unsigned d = 1; !frontier.empty(); ++d) {
+            for (const auto& p : frontier) {
+                for (const auto& n : p.neighbours()) {
+                    if (maze.has(n) && maze[n] == '.' && dist[n] == ~0U) {
+                        dist[n] = d;
+                        next.push_back(n);
+                    }
+                }
+            }
+            reached += next.size();
+            frontier.swap(next);
+            next.clear();
+        }
+        return reached;
+    }
+
+    template <typename Layout>
+    std::size_t stencil(const grid<char, Layout>& maze) {
+        grid<unsigned char, Layout> out{maze.width(), maze.height()};
+        std::size_t total = 0;
+        for (std::size_t x = 1; x + 1 < size; ++x) {
+            for (std::size_t y = 1; y + 1 < size; ++y) {
+                const auto count = (maze.at(x - 1, y) == '#') + (maze.at(x + 1, y) == '#') + (maze.at(x, y - 1) == '#') + (maze.at(x, y + 1) == '#');
+                out.at(x, y) = static_cast<unsigned char>(count);
+                total += count;
+            }
+        }
+        return total;
+    }
+
+    template <typename Layout>
+    void run_layout(const std::string& name) {
+        const auto maze = make_maze<Layout>();
+        bench::run(name + " bfs", [&maze] { return bfs(maze); });
+        bench::run(name + " stencil (column order)", [&maze] { return stencil(maze); });
+    }
+}
+
+int main() {
+    run_layout<row_major>("row_major");
+    run_layout<tiled<3>>("tiled<3>");
+    run_layout<tiled<4>>("tiled<4>");
+    run_layout<tiled<3, true>>("tiled<3, morton>");
+}
@@ -1,7 +1,34 @@
 #ifndef AOC_HPP
 #define AOC_HPP
 #include "area.hpp"
+#include "astar.hpp"
+#include "beam.hpp"
+#include "bfs.hpp"
+#include "bidirectional_bfs.hpp"
+#include "bitset.hpp"
+#include "components.hpp"
+#include "cycle.hpp"
+#include "difference.hpp"
+#include "dijkstra.hpp"
+#include "distance.hpp"
+#include "flood_fill.hpp"
+#include "grid.hpp"
+#include "hashlife.hpp"
 #include "input.hpp"
+#include "jump_point.hpp"
+#include "junction_graph.hpp"
+#include "life.hpp"
+#include "parallel.hpp"
+#include "parallel_bfs.hpp"
+#include "particles.hpp"
 #include "pos.hpp"
+#include "scheduler.hpp"
+#include "sparse_life.hpp"
+#include "summed_area.hpp"
+#include "tilt.hpp"
+#include "torus.hpp"
+#include "transform.hpp"
+#include "union_find.hpp"
+#include "zobrist.hpp"
 
 #endif  // AOC_HPP
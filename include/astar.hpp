@@ -0,0 +1,250 @@
+#ifndef ASTAR_HPP
+#define ASTAR_HPP
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "area.hpp"
+#include "bitset.hpp"
+#include "dijkstra.hpp"
+#include "pos.hpp"
+
+namespace aoc {
+    /// Admissible heuristic for 4-connected moves of cost at least 1.
+    struct manhattan_heuristic {
+        template <typename T>
+        [[nodiscard]] constexpr auto operator()(const pos<T>& p, const pos<T>& goal) const noexcept {
+            return p.manhattan(goal);
+        }
+    };
+
+    /// Admissible heuristic for 8-connected moves of cost at least 1.
+    struct chebyshev_heuristic {
+        template <typename T>
+        [[nodiscard]] constexpr auto operator()(const pos<T>& p, const pos<T>& goal) const noexcept {
+            return p.chebyshev(goal);
+        }
+    };
+
+    /// Turns A* into Dijkstra.
+    struct zero_heuristic {
+        template <typename T>
+        [[nodiscard]] constexpr int operator()(const pos<T>&, const pos<T>&) const noexcept {
+            return 0;
+        }
+
+        template <typename State>
+        [[nodiscard]] constexpr int operator()(const State&) const noexcept {
+            return 0;
+        }
+    };
+
+    /// Reusable A* search over the positions of an area, with g-values and the closed set stored flat.
+    /// `neighbours(p, emit)` calls `emit(next)` for every move, `cost(from, to)` prices it and `heuristic(p, goal)` must not overestimate.
+    template <std::integral T = std::size_t, typename Cost = std::uint64_t>
+    class astar {
+    public:
+        static constexpr Cost unreachable = std::numeric_limits<Cost>::max();
+
+        constexpr explicit astar(const area<T>& bounds)
+            : bounds_{bounds}, width_{static_cast<std::size_t>(bounds.cols())}, seen_{width_ * static_cast<std::size_t>(bounds.rows())},
+              closed_{seen_.size()}, g_(seen_.size()), parents_(seen_.size()) {}
+
+        [[nodiscard]] constexpr const area<T>& bounds() const noexcept {
+            return bounds_;
+        }
+
+        /// Returns the cost from `start` to `goal`, or `unreachable`. Ties on f are broken towards the larger g.
+        template <typename Neighbours, typename CostFunc, typename Heuristic = manhattan_heuristic>
+        Cost search(const pos<T>& start, const pos<T>& goal, Neighbours neighbours, CostFunc cost, Heuristic heuristic = {}) {
+            seen_.clear();
+            closed_.clear();
+            open_.clear();
+            expanded_ = 0;
+            generated_ = 0;
+            if (!bounds_.has(start) || !bounds_.has(goal))
+                return unreachable;
+
+            const auto goalIndex = index(goal);
+            const auto push = [&](std::size_t i, const pos<T>& p, Cost g) {
+                open_.push({static_cast<Cost>(g + static_cast<Cost>(heuristic(p, goal))), unreachable - g}, i);
+                ++generated_;
+            };
+
+            const auto startIndex = index(start);
+            seen_.set(startIndex);
+            g_[startIndex] = Cost{};
+            parents_[startIndex] = startIndex;
+            push(startIndex, start, Cost{});
+            while (!open_.empty()) {
+                const auto [key, i] = open_.pop();
+                const auto g = static_cast<Cost>(unreachable - key.second);
+                if (g != g_[i] || closed_.test_and_set(i))
+                    continue;
+                ++expanded_;
+                if (i == goalIndex)
+                    return g;
+
+                const auto p = position(i);
+                neighbours(std::as_const(p), [&](const pos<T>& next) {
+                    if (!bounds_.has(next))
+                        return;
+                    const auto n = index(next);
+                    const auto ng = static_cast<Cost>(g + static_cast<Cost>(cost(p, next)));
+                    if (seen_.test_and_set(n) && ng >= g_[n])
+                        return;
+                    g_[n] = ng;
+                    parents_[n] = i;
+                    closed_.reset(n);
+                    push(n, next, ng);
+                });
+            }
+            return unreachable;
+        }
+
+        /// Number of positions expanded by the last search.
+        [[nodiscard]] constexpr std::size_t expanded() const noexcept {
+            return expanded_;
+        }
+
+        /// Number of open list pushes made by the last search.
+        [[nodiscard]] constexpr std::size_t generated() const noexcept {
+            return generated_;
+        }
+
+        /// Returns the path from the start to `p` found by the last search, or an empty path.
+        [[nodiscard]] std::vector<pos<T>> path(const pos<T>& p) const {
+            std::vector<pos<T>> result;
+            if (!bounds_.has(p) || !closed_.test(index(p)))
+                return result;
+            for (auto i = index(p);; i = parents_[i]) {
+                result.push_back(position(i));
+                if (parents_[i] == i)
+                    break;
+            }
+            std::ranges::reverse(result);
+            return result;
+        }
+
+    private:
+        area<T> bounds_;
+        std::size_t width_;
+        bitset seen_;
+        bitset closed_;
+        std::vector<Cost> g_;
+        std::vector<std::size_t> parents_;
+        dary_heap<std::size_t, std::pair<Cost, Cost>> open_;
+        std::size_t expanded_ = 0;
+        std::size_t generated_ = 0;
+
+        [[nodiscard]] constexpr std::size_t index(const pos<T>& p) const noexcept {
+            return static_cast<std::size_t>(p.y - bounds_.min_y) * width_ + static_cast<std::size_t>(p.x - bounds_.min_x);
+        }
+
+        [[nodiscard]] constexpr pos<T> position(std::size_t i) const noexcept {
+            return pos<T>{static_cast<T>(bounds_.min_x + static_cast<T>(i % width_)), static_cast<T>(bounds_.min_y + static_cast<T>(i / width_))};
+        }
+    };
+
+    /// Reusable A* search over arbitrary hashable states, for searches whose states are not bounded positions.
+    /// Each state is stored once as a key of the hash map, and the open list and parents refer to states by their order of discovery.
+    /// `neighbours(state, emit)` calls `emit(next)` for every move, `cost(from, to)` prices it and `heuristic(state)` must not overestimate the cost to a goal.
+    template <typename State, typename Cost = std::uint64_t, typename Hash = std::hash<State>>
+    class hashed_astar {
+    public:
+        static constexpr Cost unreachable = std::numeric_limits<Cost>::max();
+
+        /// Returns the cost from `start` to the first state satisfying `goal`, or `unreachable`. Ties on f are broken towards the larger g.
+        template <std::predicate<const State&> Goal, typename Neighbours, typename CostFunc, typename Heuristic = zero_heuristic>
+        Cost search(const State& start, Goal goal, Neighbours neighbours, CostFunc cost, Heuristic heuristic = {}) {
+            index_.clear();
+            nodes_.clear();
+            open_.clear();
+            expanded_ = 0;
+            generated_ = 0;
+
+            const auto push = [&](std::size_t i, Cost g) {
+                open_.push({static_cast<Cost>(g + static_cast<Cost>(heuristic(*nodes_[i].state))), unreachable - g}, i);
+                ++generated_;
+            };
+
+            nodes_.push_back(node{&index_.try_emplace(start, 0).first->first, Cost{}, 0, false});
+            push(0, Cost{});
+            while (!open_.empty()) {
+                const auto [key, i] = open_.pop();
+                const auto g = static_cast<Cost>(unreachable - key.second);
+                if (g != nodes_[i].g || nodes_[i].closed)
+                    continue;
+                nodes_[i].closed = true;
+                ++expanded_;
+                const auto& state = *nodes_[i].state;
+                if (goal(state))
+                    return g;
+
+                neighbours(state, [&](const State& next) {
+                    const auto ng = static_cast<Cost>(g + static_cast<Cost>(cost(state, next)));
+                    const auto [it, inserted] = index_.try_emplace(next, nodes_.size());
+                    if (inserted) {
+                        nodes_.push_back(node{&it->first, ng, i, false});
+                    } else {
+                        auto& n = nodes_[it->second];
+                        if (ng >= n.g)
+                            return;
+                        n.g = ng;
+                        n.parent = i;
+                        n.closed = false;
+                    }
+                    push(it->second, ng);
+                });
+            }
+            return unreachable;
+        }
+
+        /// Number of states expanded by the last search.
+        [[nodiscard]] constexpr std::size_t expanded() const noexcept {
+            return expanded_;
+        }
+
+        /// Number of open list pushes made by the last search.
+        [[nodiscard]] constexpr std::size_t generated() const noexcept {
+            return generated_;
+        }
+
+        /// Returns the path from the start to `state` found by the last search, or an empty path.
+        [[nodiscard]] std::vector<State> path(const State& state) const {
+            std::vector<State> result;
+            const auto it = index_.find(state);
+            if (it == index_.end() || !nodes_[it->second].closed)
+                return result;
+            for (auto i = it->second;; i = nodes_[i].parent) {
+                result.push_back(*nodes_[i].state);
+                if (nodes_[i].parent == i)
+                    break;
+            }
+            std::ranges::reverse(result);
+            return result;
+        }
+
+    private:
+        /// A discovered state, pointing at its key in `index_`, which stays put as the map grows.
+        struct node {
+            const State* state;
+            Cost g;
+            std::size_t parent;
+            bool closed;
+        };
+
+        std::unordered_map<State, std::size_t, Hash> index_;
+        std::vector<node> nodes_;
+        dary_heap<std::size_t, std::pair<Cost, Cost>> open_;
+        std::size_t expanded_ = 0;
+        std::size_t generated_ = 0;
+    };
+}   // namespace aoc
+
+#endif  // ASTAR_HPP
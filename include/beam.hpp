@@ -0,0 +1,254 @@
+#ifndef BEAM_HPP
+#define BEAM_HPP
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ranges>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "grid.hpp"
+#include "parallel.hpp"
+#include "pos.hpp"
+
+namespace aoc {
+    /// Represents a beam entering cell `at` while heading `heading`, where `direction::north` is towards row 0 and so along `pos::down()`.
+    struct beam {
+        pos<std::size_t> at;
+        direction heading;
+
+        [[nodiscard]] constexpr bool operator==(const beam&) const noexcept = default;
+    };
+
+    /// Returns the bit for `dir` in a mask of directions.
+    [[nodiscard]] constexpr std::uint8_t direction_bit(direction dir) noexcept {
+        return static_cast<std::uint8_t>(1U << static_cast<unsigned>(dir));
+    }
+
+    /// Splits and turns beams on the cells `/`, `\`, `|` and `-`, and lets them pass through any other cell.
+    struct mirror_optics {
+        template <typename T>
+        [[nodiscard]] constexpr std::uint8_t operator()(const T& cell, direction heading) const noexcept {
+            const bool vertical = heading == direction::north || heading == direction::south;
+            switch (cell) {
+                case '/':
+                    return direction_bit(heading == direction::north ? direction::east : heading == direction::east ? direction::north : heading == direction::south ? direction::west : direction::south);
+                case '\\':
+                    return direction_bit(heading == direction::north ? direction::west : heading == direction::west ? direction::north : heading == direction::south ? direction::east : direction::south);
+                case '|':
+                    return vertical ? direction_bit(heading) : direction_bit(direction::north) | direction_bit(direction::south);
+                case '-':
+                    return vertical ? direction_bit(direction::east) | direction_bit(direction::west) : direction_bit(heading);
+                default:
+                    return direction_bit(heading);
+            }
+        }
+    };
+
+    /// Traces beams through a grid of optical cells, counting the cells they energise.
+    /// Where each beam goes next is precomputed per cell and direction, and the runs of cells a beam passes straight through are
+    /// collapsed into cached segments, so a trace only stops on cells that turn or split it. Those cells keep a bitmask of the
+    /// directions already traced through them, which cuts loops short.
+    class beam_tracer {
+    public:
+        static constexpr std::uint32_t npos = std::numeric_limits<std::uint32_t>::max();
+
+        /// Creates a tracer for a grid, where `optics(cell, heading)` returns the mask of directions a beam entering `cell` leaves in.
+        template <typename T, typename Layout, typename Optics = mirror_optics>
+        explicit beam_tracer(const grid<T, Layout>& g, Optics optics = Optics{}) : width_{g.width()}, height_{g.height()} {
+            if (width_ * height_ >= npos)
+                throw std::out_of_range{"g"};
+            const auto cells = width_ * height_;
+            out_.resize(cells * 4);
+            for (std::size_t y = 0; y < height_; ++y)
+                for (std::size_t x = 0; x < width_; ++x)
+                    for (unsigned d = 0; d < 4; ++d)
+                        out_[(y * width_ + x) * 4 + d] = static_cast<std::uint8_t>(optics(g.at(x, y), static_cast<direction>(d)) & 0x0F);
+
+            next_.assign(cells * 4, npos);
+            state_.resize(cells);
+            if (cells == 0)
+                return;
+            for (std::size_t y = 0; y < height_; ++y) {
+                for (std::size_t x = 1; x < width_; ++x)
+                    link(y * width_ + x, y * width_ + x - 1, direction::west);
+                for (std::size_t x = width_ - 1; x-- > 0;)
+                    link(y * width_ + x, y * width_ + x + 1, direction::east);
+            }
+            for (std::size_t x = 0; x < width_; ++x) {
+                for (std::size_t y = 1; y < height_; ++y)
+                    link(y * width_ + x, (y - 1) * width_ + x, direction::north);
+                for (std::size_t y = height_ - 1; y-- > 0;)
+                    link(y * width_ + x, (y + 1) * width_ + x, direction::south);
+            }
+        }
+
+        [[nodiscard]] constexpr std::size_t width() const noexcept {
+            return width_;
+        }
+
+        [[nodiscard]] constexpr std::size_t height() const noexcept {
+            return height_;
+        }
+
+        /// Traces one beam and returns how many cells it energises, which `energised` then reports until the next trace.
+        std::size_t trace(const beam& b) {
+            return trace(b, state_);
+        }
+
+        /// Returns whether the last beam passed to `trace` energised the cell.
+        [[nodiscard]] bool energised(std::size_t x, std::size_t y) const noexcept {
+            return state_.epoch != 0 && state_.lit[y * width_ + x] == state_.epoch;
+        }
+
+        /// Returns the number of cells energised by each beam, tracing them independently across `threads` threads (0 for all cores).
+        template <std::ranges::random_access_range Rng>
+        [[nodiscard]] std::vector<std::size_t> trace_all(const Rng& beams, std::size_t threads = 1) const {
+            std::vector<std::size_t> result(std::ranges::size(beams));
+            parallel_bands(result.size(), threads, [&](std::size_t begin, std::size_t end) {
+                if (begin == end)
+                    return;
+                trace_state state;
+                state.resize(width_ * height_);
+                for (auto i = begin; i < end; ++i)
+                    result[i] = trace(std::ranges::begin(beams)[i], state);
+            });
+            return result;
+        }
+
+        /// Returns every beam entering the grid from an edge: down each column, up each column, rightwards along each row and leftwards along each row.
+        [[nodiscard]] std::vector<beam> edge_beams() const {
+            std::vector<beam> result;
+            if (width_ == 0 || height_ == 0)
+                return result;
+            result.reserve(2 * (width_ + height_));
+            for (std::size_t x = 0; x < width_; ++x)
+                result.push_back(beam{pos<std::size_t>{x, 0}, direction::south});
+            for (std::size_t x = 0; x < width_; ++x)
+                result.push_back(beam{pos<std::size_t>{x, height_ - 1}, direction::north});
+            for (std::size_t y = 0; y < height_; ++y)
+                result.push_back(beam{pos<std::size_t>{0, y}, direction::east});
+            for (std::size_t y = 0; y < height_; ++y)
+                result.push_back(beam{pos<std::size_t>{width_ - 1, y}, direction::west});
+            return result;
+        }
+
+        /// Returns the most cells energised by any beam entering from an edge.
+        [[nodiscard]] std::size_t max_energised(std::size_t threads = 1) const {
+            const auto counts = trace_all(edge_beams(), threads);
+            return counts.empty() ? 0 : std::ranges::max(counts);
+        }
+
+    private:
+        /// Per-trace marks, stamped with the trace's epoch so they never need clearing.
+        struct trace_state {
+            std::vector<std::uint32_t> lit;
+            std::vector<std::uint32_t> seen;
+            std::vector<std::uint8_t> directions;
+            std::vector<std::pair<std::uint32_t, direction>> stack;
+            std::uint32_t epoch = 0;
+
+            void resize(std::size_t cells) {
+                lit.assign(cells, 0);
+                seen.assign(cells, 0);
+                directions.assign(cells, 0);
+            }
+
+            void advance() {
+                if (++epoch == 0) {
+                    std::ranges::fill(lit, 0);
+                    std::ranges::fill(seen, 0);
+                    epoch = 1;
+                }
+            }
+        };
+
+        std::size_t width_;
+        std::size_t height_;
+        std::vector<std::uint8_t> out_;
+        std::vector<std::uint32_t> next_;
+        trace_state state_;
+
+        [[nodiscard]] bool passes(std::size_t cell, direction heading) const noexcept {
+            return out_[cell * 4 + static_cast<std::size_t>(heading)] == direction_bit(heading);
+        }
+
+        /// Sets where a beam leaving `from` towards `heading` stops, given that `to` is the next cell that way and is already linked.
+        void link(std::size_t from, std::size_t to, direction heading) {
+            const auto d = static_cast<std::size_t>(heading);
+            next_[from * 4 + d] = passes(to, heading) ? next_[to * 4 + d] : static_cast<std::uint32_t>(to);
+        }
+
+        [[nodiscard]] std::ptrdiff_t offset(direction heading) const noexcept {
+            const auto w = static_cast<std::ptrdiff_t>(width_);
+            return heading == direction::north ? -w : heading == direction::east ? 1 : heading == direction::south ? w : -1;
+        }
+
+        /// Returns the last cell a beam leaving `cell` towards `heading` can reach before the edge.
+        [[nodiscard]] std::size_t edge(std::size_t cell, direction heading) const noexcept {
+            const auto x = cell % width_;
+            const auto y = cell / width_;
+            switch (heading) {
+                case direction::north:
+                    return x;
+                case direction::east:
+                    return y * width_ + width_ - 1;
+                case direction::south:
+                    return (height_ - 1) * width_ + x;
+                default:
+                    return y * width_;
+            }
+        }
+
+        std::size_t trace(const beam& b, trace_state& state) const {
+            state.advance();
+            std::size_t count = 0;
+            const auto light = [&state, &count](std::size_t cell) {
+                if (state.lit[cell] != state.epoch) {
+                    state.lit[cell] = state.epoch;
+                    ++count;
+                }
+            };
+            // lights the cells a beam passes leaving `cell` towards `heading`, and queues the cell where it stops
+            const auto follow = [&](std::size_t cell, direction heading) {
+                const auto stop = next_[cell * 4 + static_cast<std::size_t>(heading)];
+                const auto last = stop == npos ? edge(cell, heading) : stop;
+                const auto step = offset(heading);
+                for (auto i = cell; i != last;) {
+                    i = static_cast<std::size_t>(static_cast<std::ptrdiff_t>(i) + step);
+                    light(i);
+                }
+                if (stop != npos)
+                    state.stack.emplace_back(stop, heading);
+            };
+
+            const auto start = b.at.y * width_ + b.at.x;
+            light(start);
+            if (passes(start, b.heading))
+                follow(start, b.heading);
+            else
+                state.stack.emplace_back(static_cast<std::uint32_t>(start), b.heading);
+
+            while (!state.stack.empty()) {
+                const auto [cell, heading] = state.stack.back();
+                state.stack.pop_back();
+                const auto bit = direction_bit(heading);
+                if (state.seen[cell] != state.epoch) {
+                    state.seen[cell] = state.epoch;
+                    state.directions[cell] = 0;
+                }
+                if (state.directions[cell] & bit)
+                    continue;
+                state.directions[cell] |= bit;
+                for (unsigned d = 0; d < 4; ++d)
+                    if (out_[cell * 4 + static_cast<std::size_t>(heading)] >> d & 1)
+                        follow(cell, static_cast<direction>(d));
+            }
+            return count;
+        }
+    };
+}   // namespace aoc
+
+#endif  // BEAM_HPP
@@ -0,0 +1,156 @@
+#ifndef BFS_HPP
+#define BFS_HPP
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ranges>
+#include <utility>
+#include <vector>
+#include "area.hpp"
+#include "bitset.hpp"
+#include "grid.hpp"
+#include "pos.hpp"
+
+namespace aoc {
+    /// Reusable breadth-first search over the cells of an area, keeping its buffers between runs.
+    /// `passable` is called with the cell's `pos<T>` when it accepts one, otherwise with the cell's row-major index within the area.
+    template <std::integral T = std::size_t>
+    class bfs {
+    public:
+        static constexpr std::uint32_t unreachable = std::numeric_limits<std::uint32_t>::max();
+
+        constexpr explicit bfs(const area<T>& bounds, connectivity conn = connectivity::four, bool parents = false)
+            : bounds_{bounds}, width_{static_cast<std::size_t>(bounds.cols())}, height_{static_cast<std::size_t>(bounds.rows())}, conn_{conn},
+              visited_{width_ * height_}, distances_(width_ * height_), parents_(parents ? width_ * height_ : 0) {}
+
+        [[nodiscard]] constexpr const area<T>& bounds() const noexcept {
+            return bounds_;
+        }
+
+        [[nodiscard]] constexpr std::size_t index(const pos<T>& p) const noexcept {
+            return static_cast<std::size_t>(p.y - bounds_.min_y) * width_ + static_cast<std::size_t>(p.x - bounds_.min_x);
+        }
+
+        [[nodiscard]] constexpr pos<T> position(std::size_t i) const noexcept {
+            return pos<T>{static_cast<T>(bounds_.min_x + static_cast<T>(i % width_)), static_cast<T>(bounds_.min_y + static_cast<T>(i / width_))};
+        }
+
+        /// Explores everything reachable from `starts` and returns the number of cells reached.
+        template <std::ranges::input_range Rng, typename Pass>
+        std::size_t run(const Rng& starts, Pass passable) {
+            return explore(starts, passable, npos).second;
+        }
+
+        template <typename Pass>
+        std::size_t run(const pos<T>& start, Pass passable) {
+            return run(std::array{start}, passable);
+        }
+
+        /// Returns the distance from the nearest of `starts` to `goal`, stopping as soon as it is found.
+        template <std::ranges::input_range Rng, typename Pass>
+        std::uint32_t search(const Rng& starts, const pos<T>& goal, Pass passable) {
+            if (!bounds_.has(goal)) {
+                visited_.clear();
+                return unreachable;
+            }
+            return explore(starts, passable, index(goal)).first;
+        }
+
+        template <typename Pass>
+        std::uint32_t search(const pos<T>& start, const pos<T>& goal, Pass passable) {
+            return search(std::array{start}, goal, passable);
+        }
+
+        [[nodiscard]] constexpr bool reached(const pos<T>& p) const noexcept {
+            return bounds_.has(p) && visited_.test(index(p));
+        }
+
+        /// Returns the distance to `p` found by the last run, or `unreachable`.
+        [[nodiscard]] constexpr std::uint32_t distance(const pos<T>& p) const noexcept {
+            return reached(p) ? distances_[index(p)] : unreachable;
+        }
+
+        /// Returns the path from a start to `p` found by the last run, or an empty path. Requires parent tracking.
+        [[nodiscard]] std::vector<pos<T>> path(const pos<T>& p) const {
+            std::vector<pos<T>> result;
+            if (parents_.empty() || !reached(p))
+                return result;
+            for (auto i = index(p);; i = parents_[i]) {
+                result.push_back(position(i));
+                if (parents_[i] == i)
+                    break;
+            }
+            std::ranges::reverse(result);
+            return result;
+        }
+
+    private:
+        static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+        area<T> bounds_;
+        std::size_t width_;
+        std::size_t height_;
+        connectivity conn_;
+        bitset visited_;
+        std::vector<std::uint32_t> distances_;
+        std::vector<std::size_t> parents_;
+        std::vector<std::size_t> frontier_;
+        std::vector<std::size_t> next_;
+
+        template <typename Pass>
+        [[nodiscard]] constexpr bool is_passable(Pass& passable, std::size_t i) const {
+            if constexpr (std::predicate<Pass&, pos<T>>)
+                return passable(position(i));
+            else
+                return passable(i);
+        }
+
+        template <std::ranges::input_range Rng, typename Pass>
+        std::pair<std::uint32_t, std::size_t> explore(const Rng& starts, Pass& passable, std::size_t goal) {
+            visited_.clear();
+            frontier_.clear();
+            next_.clear();
+            std::size_t count = 0;
+            for (const pos<T>& start : starts) {
+                if (!bounds_.has(start))
+                    continue;
+                const auto i = index(start);
+                if (visited_.test_and_set(i))
+                    continue;
+                distances_[i] = 0;
+                if (!parents_.empty())
+                    parents_[i] = i;
+                if (i == goal)
+                    return {0, 1};
+                frontier_.push_back(i);
+                ++count;
+            }
+
+            for (std::uint32_t d = 1; !frontier_.empty(); ++d) {
+                for (const auto i : frontier_) {
+                    const bool found = detail::any_neighbour(i, width_, height_, conn_, [&](std::size_t n) {
+                        if (visited_.test(n) || !is_passable(passable, n))
+                            return false;
+                        visited_.set(n);
+                        distances_[n] = d;
+                        if (!parents_.empty())
+                            parents_[n] = i;
+                        next_.push_back(n);
+                        ++count;
+                        return n == goal;
+                    });
+                    if (found)
+                        return {d, count};
+                }
+                frontier_.swap(next_);
+                next_.clear();
+            }
+            return {unreachable, count};
+        }
+    };
+}   // namespace aoc
+
+#endif  // BFS_HPP
@@ -0,0 +1,198 @@
+#ifndef BIDIRECTIONAL_BFS_HPP
+#define BIDIRECTIONAL_BFS_HPP
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "area.hpp"
+#include "bitset.hpp"
+#include "grid.hpp"
+#include "pos.hpp"
+
+namespace aoc {
+    /// Represents the length of a shortest path and the states along it, start and goal included.
+    template <typename State>
+    struct search_path {
+        std::uint32_t distance = std::numeric_limits<std::uint32_t>::max();
+        std::vector<State> path;
+    };
+
+    /// Reusable single-pair breadth-first search over the cells of an area, growing the smaller of two frontiers one level at a time.
+    /// `passable` is called with the cell's `pos<T>` when it accepts one, otherwise with its row-major index within the area.
+    template <std::integral T = std::size_t>
+    class bidirectional_bfs {
+    public:
+        static constexpr std::uint32_t unreachable = std::numeric_limits<std::uint32_t>::max();
+
+        constexpr explicit bidirectional_bfs(const area<T>& bounds, connectivity conn = connectivity::four)
+            : bounds_{bounds}, width_{static_cast<std::size_t>(bounds.cols())}, height_{static_cast<std::size_t>(bounds.rows())}, conn_{conn},
+              visited_{bitset{width_ * height_}, bitset{width_ * height_}},
+              distances_{std::vector<std::uint32_t>(width_ * height_), std::vector<std::uint32_t>(width_ * height_)},
+              parents_{std::vector<std::size_t>(width_ * height_), std::vector<std::size_t>(width_ * height_)} {}
+
+        [[nodiscard]] constexpr const area<T>& bounds() const noexcept {
+            return bounds_;
+        }
+
+        /// Returns the distance from `start` to `goal`, or `unreachable`. Like `bfs::search`, the start is trusted but the goal must be passable.
+        template <typename Pass>
+        std::uint32_t search(const pos<T>& start, const pos<T>& goal, Pass passable) {
+            best_ = unreachable;
+            for (std::size_t side = 0; side < 2; ++side) {
+                visited_[side].clear();
+                frontiers_[side].clear();
+            }
+            if (!bounds_.has(start) || !bounds_.has(goal) || (start != goal && !is_passable(passable, index(goal))))
+                return unreachable;
+
+            for (std::size_t side = 0; side < 2; ++side) {
+                const auto i = index(side == 0 ? start : goal);
+                visited_[side].set(i);
+                distances_[side][i] = 0;
+                parents_[side][i] = i;
+                frontiers_[side].push_back(i);
+            }
+            if (start == goal) {
+                meet_ = {index(start), index(start)};
+                return best_ = 0;
+            }
+
+            while (!frontiers_[0].empty() && !frontiers_[1].empty()) {
+                const std::size_t side = frontiers_[0].size() <= frontiers_[1].size() ? 0 : 1;
+                const std::size_t other = 1 - side;
+                next_.clear();
+                for (const auto i : frontiers_[side]) {
+                    detail::any_neighbour(i, width_, height_, conn_, [&](std::size_t n) {
+                        if (visited_[other].test(n)) {
+                            const auto total = distances_[side][i] + 1 + distances_[other][n];
+                            if (total < best_) {
+                                best_ = total;
+                                meet_ = side == 0 ? std::pair{i, n} : std::pair{n, i};
+                            }
+                        }
+                        if (visited_[side].test(n) || !is_passable(passable, n))
+                            return false;
+                        visited_[side].set(n);
+                        distances_[side][n] = distances_[side][i] + 1;
+                        parents_[side][n] = i;
+                        next_.push_back(n);
+                        return false;
+                    });
+                }
+                if (best_ != unreachable)
+                    return best_;
+                frontiers_[side].swap(next_);
+            }
+            return unreachable;
+        }
+
+        /// Returns the path found by the last search, or an empty path.
+        [[nodiscard]] std::vector<pos<T>> path() const {
+            std::vector<pos<T>> result;
+            if (best_ == unreachable)
+                return result;
+            for (auto i = meet_.first;; i = parents_[0][i]) {
+                result.push_back(position(i));
+                if (parents_[0][i] == i)
+                    break;
+            }
+            std::ranges::reverse(result);
+            if (meet_.second == meet_.first)
+                return result;
+            for (auto i = meet_.second;; i = parents_[1][i]) {
+                result.push_back(position(i));
+                if (parents_[1][i] == i)
+                    break;
+            }
+            return result;
+        }
+
+    private:
+        area<T> bounds_;
+        std::size_t width_;
+        std::size_t height_;
+        connectivity conn_;
+        std::array<bitset, 2> visited_;
+        std::array<std::vector<std::uint32_t>, 2> distances_;
+        std::array<std::vector<std::size_t>, 2> parents_;
+        std::array<std::vector<std::size_t>, 2> frontiers_;
+        std::vector<std::size_t> next_;
+        std::pair<std::size_t, std::size_t> meet_{};
+        std::uint32_t best_ = unreachable;
+
+        [[nodiscard]] constexpr std::size_t index(const pos<T>& p) const noexcept {
+            return static_cast<std::size_t>(p.y - bounds_.min_y) * width_ + static_cast<std::size_t>(p.x - bounds_.min_x);
+        }
+
+        [[nodiscard]] constexpr pos<T> position(std::size_t i) const noexcept {
+            return pos<T>{static_cast<T>(bounds_.min_x + static_cast<T>(i % width_)), static_cast<T>(bounds_.min_y + static_cast<T>(i / width_))};
+        }
+
+        template <typename Pass>
+        [[nodiscard]] bool is_passable(Pass& passable, std::size_t i) const {
+            if constexpr (std::predicate<Pass&, pos<T>>)
+                return passable(position(i));
+            else
+                return passable(i);
+        }
+    };
+
+    /// Finds a shortest path between two hashable states by searching from both ends.
+    /// `neighbours(state, emit)` calls `emit(next)` for every move, and every move must be reversible.
+    template <typename State, typename Neighbours, typename Hash = std::hash<State>>
+    [[nodiscard]] search_path<State> bidirectional_search(const State& start, const State& goal, Neighbours neighbours) {
+        search_path<State> result;
+        if (start == goal) {
+            result.distance = 0;
+            result.path.push_back(start);
+            return result;
+        }
+
+        // each side maps a state to its distance and the state it was reached from
+        std::array<std::unordered_map<State, std::pair<std::uint32_t, State>, Hash>, 2> seen;
+        std::array<std::vector<State>, 2> frontiers{std::vector{start}, std::vector{goal}};
+        seen[0].emplace(start, std::pair{0U, start});
+        seen[1].emplace(goal, std::pair{0U, goal});
+        std::vector<State> next;
+        std::pair<State, State> meet{start, goal};
+        while (!frontiers[0].empty() && !frontiers[1].empty() && result.path.empty()) {
+            const std::size_t side = frontiers[0].size() <= frontiers[1].size() ? 0 : 1;
+            const std::size_t other = 1 - side;
+            next.clear();
+            for (const auto& state : frontiers[side]) {
+                const auto distance = seen[side].at(state).first;
+                neighbours(state, [&](const State& n) {
+                    if (const auto it = seen[other].find(n); it != seen[other].end() && distance + 1 + it->second.first < result.distance) {
+                        result.distance = distance + 1 + it->second.first;
+                        meet = side == 0 ? std::pair{state, n} : std::pair{n, state};
+                    }
+                    if (seen[side].try_emplace(n, std::pair{distance + 1, state}).second)
+                        next.push_back(n);
+                });
+            }
+            if (result.distance != std::numeric_limits<std::uint32_t>::max()) {
+                for (auto s = meet.first;; s = seen[0].at(s).second) {
+                    result.path.push_back(s);
+                    if (s == start)
+                        break;
+                }
+                std::ranges::reverse(result.path);
+                for (auto s = meet.second;; s = seen[1].at(s).second) {
+                    result.path.push_back(s);
+                    if (s == goal)
+                        break;
+                }
+            }
+            frontiers[side].swap(next);
+        }
+        return result;
+    }
+}   // namespace aoc
+
+#endif  // BIDIRECTIONAL_BFS_HPP
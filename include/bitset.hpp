@@ -0,0 +1,93 @@
+#ifndef BITSET_HPP
+#define BITSET_HPP
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace aoc {
+    /// Represents a runtime-sized set of bits packed into 64-bit words.
+    class bitset {
+    public:
+        using word_type = std::uint64_t;
+        static constexpr std::size_t word_bits = 64;
+
+        constexpr bitset() = default;
+
+        constexpr explicit bitset(std::size_t size) : size_{size}, words_((size + word_bits - 1) / word_bits) {}
+
+        [[nodiscard]] constexpr std::size_t size() const noexcept {
+            return size_;
+        }
+
+        [[nodiscard]] constexpr bool test(std::size_t i) const noexcept {
+            return words_[i / word_bits] >> (i % word_bits) & 1;
+        }
+
+        constexpr void set(std::size_t i) noexcept {
+            words_[i / word_bits] |= word_type{1} << (i % word_bits);
+        }
+
+        constexpr void reset(std::size_t i) noexcept {
+            words_[i / word_bits] &= ~(word_type{1} << (i % word_bits));
+        }
+
+        /// Sets bit `i` and returns its previous value.
+        constexpr bool test_and_set(std::size_t i) noexcept {
+            auto& word = words_[i / word_bits];
+            const auto mask = word_type{1} << (i % word_bits);
+            const bool result = word & mask;
+            word |= mask;
+            return result;
+        }
+
+        /// Atomically sets bit `i` and returns its previous value, so several threads may share one bitset.
+        bool atomic_test_and_set(std::size_t i) noexcept {
+            const auto mask = word_type{1} << (i % word_bits);
+            return std::atomic_ref<word_type>{words_[i / word_bits]}.fetch_or(mask, std::memory_order_relaxed) & mask;
+        }
+
+        /// Reads bit `i` while other threads may be setting bits in the same word.
+        [[nodiscard]] bool atomic_test(std::size_t i) noexcept {
+            return std::atomic_ref<word_type>{words_[i / word_bits]}.load(std::memory_order_relaxed) >> (i % word_bits) & 1;
+        }
+
+        constexpr void clear() noexcept {
+            std::ranges::fill(words_, 0);
+        }
+
+        constexpr void resize(std::size_t size) {
+            size_ = size;
+            words_.resize((size + word_bits - 1) / word_bits);
+            if (size % word_bits != 0)
+                words_.back() &= (word_type{1} << (size % word_bits)) - 1;
+        }
+
+        [[nodiscard]] constexpr std::size_t count() const noexcept {
+            std::size_t result = 0;
+            for (const auto word : words_)
+                result += static_cast<std::size_t>(std::popcount(word));
+            return result;
+        }
+
+        [[nodiscard]] constexpr word_type* data() noexcept {
+            return words_.data();
+        }
+
+        [[nodiscard]] constexpr const word_type* data() const noexcept {
+            return words_.data();
+        }
+
+        [[nodiscard]] constexpr std::size_t words() const noexcept {
+            return words_.size();
+        }
+
+    private:
+        std::size_t size_ = 0;
+        std::vector<word_type> words_;
+    };
+}   // namespace aoc
+
+#endif  // BITSET_HPP
@@ -0,0 +1,94 @@
+#ifndef COMPONENTS_HPP
+#define COMPONENTS_HPP
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+#include "area.hpp"
+#include "grid.hpp"
+#include "pos.hpp"
+#include "union_find.hpp"
+
+namespace aoc {
+    /// Represents the shape of one connected component.
+    struct region {
+        std::size_t cells = 0;
+        std::size_t perimeter = 0;
+        std::size_t sides = 0;
+        area<std::size_t> bounds{0};
+        pos<std::size_t> seed{0};
+    };
+
+    /// Represents every component of a grid; `labels` maps each cell to its index in `regions`.
+    struct components {
+        grid<std::uint32_t> labels;
+        std::vector<region> regions;
+    };
+
+    /// Labels the connected components of a grid, where adjacent cells join when `same(a, b)` holds for their values.
+    /// `same` must be an equivalence relation. Perimeter and sides are measured along cell edges.
+    template <typename Grid, typename Same = std::equal_to<>>
+    [[nodiscard]] components label_components(const Grid& g, connectivity conn = connectivity::four, Same same = {}) {
+        const auto width = g.width();
+        const auto height = g.height();
+        union_find sets{width * height};
+        for (std::size_t y = 0; y < height; ++y) {
+            for (std::size_t x = 0; x < width; ++x) {
+                const auto i = y * width + x;
+                const auto& value = g.at(x, y);
+                if (x > 0 && std::invoke(same, value, g.at(x - 1, y)))
+                    sets.unite(i, i - 1);
+                if (y > 0 && std::invoke(same, value, g.at(x, y - 1)))
+                    sets.unite(i, i - width);
+                if (conn == connectivity::eight && y > 0) {
+                    if (x > 0 && std::invoke(same, value, g.at(x - 1, y - 1)))
+                        sets.unite(i, i - width - 1);
+                    if (x + 1 < width && std::invoke(same, value, g.at(x + 1, y - 1)))
+                        sets.unite(i, i - width + 1);
+                }
+            }
+        }
+
+        constexpr auto unlabelled = std::numeric_limits<std::uint32_t>::max();
+        components result{grid<std::uint32_t>{width, height}, {}};
+        result.regions.reserve(sets.sets());
+        std::vector<std::uint32_t> compact(width * height, unlabelled);
+        const auto matches = [&](const auto& value, std::size_t x, std::size_t y, int dx, int dy) {
+            const auto nx = x + static_cast<std::size_t>(dx);
+            const auto ny = y + static_cast<std::size_t>(dy);
+            return nx < width && ny < height && std::invoke(same, value, g.at(nx, ny));
+        };
+
+        for (std::size_t y = 0; y < height; ++y) {
+            for (std::size_t x = 0; x < width; ++x) {
+                auto& label = compact[sets.find(y * width + x)];
+                if (label == unlabelled) {
+                    label = static_cast<std::uint32_t>(result.regions.size());
+                    result.regions.push_back(region{0, 0, 0, area<std::size_t>{x, y, x, y}, pos<std::size_t>{x, y}});
+                }
+                result.labels.at(x, y) = label;
+
+                auto& r = result.regions[label];
+                const auto& value = g.at(x, y);
+                ++r.cells;
+                r.bounds.min_x = std::min(r.bounds.min_x, x);
+                r.bounds.max_x = std::max(r.bounds.max_x, x);
+                r.bounds.max_y = y;
+                for (const auto& [dx, dy] : std::array{std::pair{1, 1}, std::pair{1, -1}, std::pair{-1, 1}, std::pair{-1, -1}}) {
+                    const bool horizontal = matches(value, x, y, dx, 0);
+                    const bool vertical = matches(value, x, y, 0, dy);
+                    r.perimeter += !horizontal && dy > 0;
+                    r.perimeter += !vertical && dx > 0;
+                    r.sides += (!horizontal && !vertical) || (horizontal && vertical && !matches(value, x, y, dx, dy));
+                }
+            }
+        }
+        return result;
+    }
+}   // namespace aoc
+
+#endif  // COMPONENTS_HPP
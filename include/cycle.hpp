@@ -0,0 +1,141 @@
+#ifndef CYCLE_HPP
+#define CYCLE_HPP
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ranges>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "grid.hpp"
+
+namespace aoc {
+    /// Represents a cycle in a deterministic sequence of states: the state after `start` steps first recurs `length` steps later.
+    struct cycle_info {
+        std::size_t start = 0;
+        std::size_t length = 0;
+
+        /// Returns the earliest step whose state equals the state after `steps` steps.
+        [[nodiscard]] constexpr std::size_t reduce(std::size_t steps) const noexcept {
+            return steps < start ? steps : start + (steps - start) % length;
+        }
+
+        [[nodiscard]] constexpr bool operator==(const cycle_info&) const noexcept = default;
+    };
+
+    /// What the cycle detection of `simulate` remembers: every state, or only a 64-bit hash of each, trusting that hashes do not collide.
+    enum class cycle_memory { states, hashes };
+
+    /// Hashes simulation states: anything `std::hash` supports, grids by their cells, and other ranges by their elements.
+    /// Grids hash only the cells inside their bounds in row order, so grids that compare equal hash the same whatever their layout pads.
+    struct state_hash {
+        template <typename State>
+        [[nodiscard]] std::size_t operator()(const State& state) const {
+            if constexpr (requires { std::hash<State>{}(state); }) {
+                return std::hash<State>{}(state);
+            } else if constexpr (requires { typename State::layout_type; }) {
+                if constexpr (std::same_as<typename State::layout_type, row_major>) {
+                    return combine(state.data(), state.data() + state.size(), state.width());
+                } else {
+                    auto result = state.width();
+                    for (std::size_t y = 0; y < state.height(); ++y)
+                        for (std::size_t x = 0; x < state.width(); ++x)
+                            mix(result, (*this)(state.at(x, y)));
+                    return result;
+                }
+            } else {
+                static_assert(std::ranges::input_range<State>, "state must be hashable");
+                return combine(std::ranges::begin(state), std::ranges::end(state), 0);
+            }
+        }
+
+    private:
+        static constexpr void mix(std::size_t& result, std::size_t h) noexcept {
+            result ^= h + 0x9E3779B97F4A7C15ULL + (result << 6) + (result >> 2);
+        }
+
+        template <typename It, typename End>
+        [[nodiscard]] std::size_t combine(It first, End last, std::size_t seed) const {
+            std::size_t result = seed;
+            for (; first != last; ++first)
+                mix(result, (*this)(*first));
+            return result;
+        }
+    };
+
+    namespace detail {
+        /// Applies one step, which either updates the state in place or returns the next one.
+        template <typename State, typename Step>
+        void advance(State& state, Step& step) {
+            if constexpr (std::is_void_v<std::invoke_result_t<Step&, State&>>)
+                step(state);
+            else
+                state = step(std::as_const(state));
+        }
+    }   // namespace detail
+
+    /// Finds the cycle reached from `state` with Brent's algorithm, keeping only two states in memory.
+    /// Compares states with `==`, and never returns if the sequence does not cycle.
+    template <std::equality_comparable State, typename Step>
+    [[nodiscard]] cycle_info find_cycle(const State& state, Step step) {
+        std::size_t power = 1;
+        std::size_t length = 1;
+        State tortoise = state;
+        State hare = state;
+        detail::advance(hare, step);
+        while (tortoise != hare) {
+            if (power == length) {
+                tortoise = hare;
+                power *= 2;
+                length = 0;
+            }
+            detail::advance(hare, step);
+            ++length;
+        }
+
+        tortoise = state;
+        hare = state;
+        for (std::size_t i = 0; i < length; ++i)
+            detail::advance(hare, step);
+        std::size_t start = 0;
+        while (tortoise != hare) {
+            detail::advance(tortoise, step);
+            detail::advance(hare, step);
+            ++start;
+        }
+        return cycle_info{start, length};
+    }
+
+    /// Returns the state after `steps` steps, stepping only until the first repeated state and then jumping ahead by whole cycles.
+    /// `step(state)` either updates the state in place or returns the next one. With `cycle_memory::hashes` no states are kept,
+    /// and the few steps left after the jump are replayed from the current state instead.
+    template <std::equality_comparable State, typename Step, typename Hash = state_hash>
+    [[nodiscard]] State simulate(State state, std::size_t steps, Step step, cycle_memory memory = cycle_memory::states, Hash hash = {}) {
+        std::unordered_multimap<std::uint64_t, std::size_t> seen;
+        std::vector<State> history;
+        for (std::size_t i = 0; i < steps; ++i) {
+            const auto h = static_cast<std::uint64_t>(hash(std::as_const(state)));
+            const auto [first, last] = seen.equal_range(h);
+            for (auto it = first; it != last; ++it) {
+                if (memory == cycle_memory::states && history[it->second] != state)
+                    continue;
+                const cycle_info cycle{it->second, i - it->second};
+                if (memory == cycle_memory::states)
+                    return std::move(history[cycle.reduce(steps)]);
+                for (auto remaining = (steps - i) % cycle.length; remaining > 0; --remaining)
+                    detail::advance(state, step);
+                return state;
+            }
+
+            seen.emplace(h, i);
+            if (memory == cycle_memory::states)
+                history.push_back(state);
+            detail::advance(state, step);
+        }
+        return state;
+    }
+}   // namespace aoc
+
+#endif  // CYCLE_HPP
@@ -0,0 +1,166 @@
+#ifndef DIFFERENCE_HPP
+#define DIFFERENCE_HPP
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+#include "area.hpp"
+#include "grid.hpp"
+#include "pos.hpp"
+
+namespace aoc {
+    /// Accumulates rectangle updates in O(1) each and materialises the resulting grid in one pass.
+    template <typename T = long long> requires std::is_arithmetic_v<T>
+    class difference_grid {
+    public:
+        constexpr explicit difference_grid(std::size_t width, std::size_t height) : width_{width}, height_{height}, diff_((width + 1) * (height + 1)) {}
+
+        [[nodiscard]] constexpr std::size_t width() const noexcept {
+            return width_;
+        }
+
+        [[nodiscard]] constexpr std::size_t height() const noexcept {
+            return height_;
+        }
+
+        /// Adds `value` to every cell inside `a`, clipped to the grid.
+        template <std::integral U>
+        constexpr void add(const area<U>& a, T value) noexcept {
+            if (width_ == 0 || height_ == 0)
+                return;
+            if constexpr (std::is_signed_v<U>)
+                if (a.max_x < 0 || a.max_y < 0)
+                    return;
+            const auto minX = static_cast<std::size_t>(std::max<U>(a.min_x, 0));
+            const auto minY = static_cast<std::size_t>(std::max<U>(a.min_y, 0));
+            const auto endX = std::min(static_cast<std::size_t>(a.max_x), width_ - 1) + 1;
+            const auto endY = std::min(static_cast<std::size_t>(a.max_y), height_ - 1) + 1;
+            if (minX >= endX || minY >= endY)
+                return;
+            diff_[minY * (width_ + 1) + minX] += value;
+            diff_[minY * (width_ + 1) + endX] -= value;
+            diff_[endY * (width_ + 1) + minX] -= value;
+            diff_[endY * (width_ + 1) + endX] += value;
+        }
+
+        /// Toggles every cell inside `a`; a materialised cell is odd if it was toggled an odd number of times.
+        template <std::integral U>
+        constexpr void toggle(const area<U>& a) noexcept {
+            add(a, T{1});
+        }
+
+        [[nodiscard]] grid<T> materialize() const {
+            grid<T> result{width_, height_};
+            std::vector<T> above(width_);
+            for (std::size_t y = 0; y < height_; ++y) {
+                T running{};
+                for (std::size_t x = 0; x < width_; ++x) {
+                    running += diff_[y * (width_ + 1) + x];
+                    above[x] += running;
+                    result.at(x, y) = above[x];
+                }
+            }
+            return result;
+        }
+
+    private:
+        std::size_t width_;
+        std::size_t height_;
+        std::vector<T> diff_;
+    };
+
+    /// Represents a grid over compressed coordinates, where each cell covers a rectangle of equal values.
+    template <typename T, std::integral C>
+    class compressed_grid {
+    public:
+        constexpr explicit compressed_grid(std::vector<C> xs, std::vector<C> ys, grid<T> cells) : xs_{std::move(xs)}, ys_{std::move(ys)}, cells_{std::move(cells)} {}
+
+        /// Returns the value at `p`, or zero outside every update.
+        [[nodiscard]] constexpr T at(const pos<C>& p) const noexcept {
+            const auto x = std::ranges::upper_bound(xs_, p.x) - xs_.begin();
+            const auto y = std::ranges::upper_bound(ys_, p.y) - ys_.begin();
+            if (x == 0 || y == 0 || x == std::ssize(xs_) || y == std::ssize(ys_))
+                return T{};
+            return cells_.at(static_cast<std::size_t>(x - 1), static_cast<std::size_t>(y - 1));
+        }
+
+        /// Calls `func(area, value)` for every compressed cell.
+        template <std::invocable<area<C>, T> Func>
+        constexpr void for_each(Func func) const {
+            for (std::size_t y = 0; y < cells_.height(); ++y)
+                for (std::size_t x = 0; x < cells_.width(); ++x)
+                    func(area<C>{xs_[x + 1] - 1, ys_[y + 1] - 1, xs_[x], ys_[y]}, cells_.at(x, y));
+        }
+
+        /// Returns the number of integer positions whose value satisfies `pred`.
+        template <std::predicate<T> Pred>
+        [[nodiscard]] constexpr C count_if(Pred pred) const {
+            C result{};
+            for_each([&result, &pred](const area<C>& a, const T& value) {
+                if (pred(value))
+                    result += a.cols() * a.rows();
+            });
+            return result;
+        }
+
+    private:
+        std::vector<C> xs_;
+        std::vector<C> ys_;
+        grid<T> cells_;
+    };
+
+    /// Accumulates rectangle updates over coordinate ranges too large for a dense grid.
+    template <typename T = long long, std::integral C = long long> requires std::is_arithmetic_v<T>
+    class compressed_difference {
+    public:
+        constexpr void add(const area<C>& a, T value) {
+            updates_.push_back({a, value});
+        }
+
+        /// Toggles every position inside `a`; a materialised value is odd if it was toggled an odd number of times.
+        constexpr void toggle(const area<C>& a) {
+            add(a, T{1});
+        }
+
+        [[nodiscard]] compressed_grid<T, C> materialize() const {
+            std::vector<C> xs;
+            std::vector<C> ys;
+            xs.reserve(updates_.size() * 2);
+            ys.reserve(updates_.size() * 2);
+            for (const auto& [a, value] : updates_) {
+                xs.push_back(a.min_x);
+                xs.push_back(a.max_x + 1);
+                ys.push_back(a.min_y);
+                ys.push_back(a.max_y + 1);
+            }
+            std::ranges::sort(xs);
+            std::ranges::sort(ys);
+            xs.erase(std::ranges::unique(xs).begin(), xs.end());
+            ys.erase(std::ranges::unique(ys).begin(), ys.end());
+
+            const auto width = xs.empty() ? 0 : xs.size() - 1;
+            const auto height = ys.empty() ? 0 : ys.size() - 1;
+            difference_grid<T> diff{width, height};
+            for (const auto& [a, value] : updates_) {
+                const auto minX = std::ranges::lower_bound(xs, a.min_x) - xs.begin();
+                const auto minY = std::ranges::lower_bound(ys, a.min_y) - ys.begin();
+                const auto endX = std::ranges::lower_bound(xs, a.max_x + 1) - xs.begin();
+                const auto endY = std::ranges::lower_bound(ys, a.max_y + 1) - ys.begin();
+                diff.add(area<std::ptrdiff_t>{endX - 1, endY - 1, minX, minY}, value);
+            }
+            return compressed_grid<T, C>{std::move(xs), std::move(ys), diff.materialize()};
+        }
+
+    private:
+        struct update {
+            area<C> bounds;
+            T value;
+        };
+
+        std::vector<update> updates_;
+    };
+}   // namespace aoc
+
+#endif  // DIFFERENCE_HPP
@@ -0,0 +1,248 @@
+#ifndef DIJKSTRA_HPP
+#define DIJKSTRA_HPP
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace aoc {
+    /// Monotone priority queue (Dial's algorithm) for edge weights no larger than `max_weight`.
+    template <typename V, std::unsigned_integral Cost = std::uint64_t>
+    class bucket_queue {
+    public:
+        constexpr explicit bucket_queue(Cost maxWeight) : buckets_(static_cast<std::size_t>(maxWeight) + 1) {
+            if (maxWeight == std::numeric_limits<Cost>::max())
+                throw std::out_of_range{"maxWeight"};
+        }
+
+        [[nodiscard]] constexpr bool empty() const noexcept {
+            return size_ == 0;
+        }
+
+        /// Pushes `value`, whose priority must lie within `max_weight` of the last popped priority.
+        constexpr void push(Cost priority, V value) {
+            buckets_[static_cast<std::size_t>(priority % buckets_.size())].push_back(std::move(value));
+            ++size_;
+        }
+
+        constexpr std::pair<Cost, V> pop() {
+            while (buckets_[static_cast<std::size_t>(current_ % buckets_.size())].empty())
+                ++current_;
+            auto& bucket = buckets_[static_cast<std::size_t>(current_ % buckets_.size())];
+            auto value = std::move(bucket.back());
+            bucket.pop_back();
+            --size_;
+            return {current_, std::move(value)};
+        }
+
+        constexpr void clear() noexcept {
+            for (auto& bucket : buckets_)
+                bucket.clear();
+            size_ = 0;
+            current_ = 0;
+        }
+
+    private:
+        std::vector<std::vector<V>> buckets_;
+        std::size_t size_ = 0;
+        Cost current_ = 0;
+    };
+
+    /// Monotone priority queue bucketing items by the highest bit in which their priority differs from the last popped one.
+    template <typename V, std::unsigned_integral Cost = std::uint64_t>
+    class radix_heap {
+    public:
+        [[nodiscard]] constexpr bool empty() const noexcept {
+            return size_ == 0;
+        }
+
+        /// Pushes `value`, whose priority must not be below the last popped priority.
+        constexpr void push(Cost priority, V value) {
+            buckets_[bucket_of(priority)].emplace_back(priority, std::move(value));
+            ++size_;
+        }
+
+        constexpr std::pair<Cost, V> pop() {
+            if (buckets_[0].empty()) {
+                std::size_t i = 1;
+                while (buckets_[i].empty())
+                    ++i;
+                last_ = std::numeric_limits<Cost>::max();
+                for (const auto& item : buckets_[i])
+                    last_ = std::min(last_, item.first);
+                for (auto& item : buckets_[i])
+                    buckets_[bucket_of(item.first)].push_back(std::move(item));
+                buckets_[i].clear();
+            }
+            auto item = std::move(buckets_[0].back());
+            buckets_[0].pop_back();
+            --size_;
+            return item;
+        }
+
+        constexpr void clear() noexcept {
+            for (auto& bucket : buckets_)
+                bucket.clear();
+            size_ = 0;
+            last_ = 0;
+        }
+
+    private:
+        std::array<std::vector<std::pair<Cost, V>>, std::numeric_limits<Cost>::digits + 1> buckets_;
+        std::size_t size_ = 0;
+        Cost last_ = 0;
+
+        [[nodiscard]] constexpr std::size_t bucket_of(Cost priority) const noexcept {
+            return static_cast<std::size_t>(std::bit_width(static_cast<Cost>(priority ^ last_)));
+        }
+    };
+
+    /// Binary-style min-heap with `D` children per node, giving shallower trees and fewer cache misses.
+    template <typename V, typename Cost = std::uint64_t, std::size_t D = 4> requires (D >= 2)
+    class dary_heap {
+    public:
+        [[nodiscard]] constexpr bool empty() const noexcept {
+            return items_.empty();
+        }
+
+        constexpr void push(Cost priority, V value) {
+            items_.emplace_back(priority, std::move(value));
+            auto i = items_.size() - 1;
+            auto item = std::move(items_[i]);
+            while (i > 0 && item.first < items_[(i - 1) / D].first) {
+                items_[i] = std::move(items_[(i - 1) / D]);
+                i = (i - 1) / D;
+            }
+            items_[i] = std::move(item);
+        }
+
+        constexpr std::pair<Cost, V> pop() {
+            auto result = std::move(items_.front());
+            auto item = std::move(items_.back());
+            items_.pop_back();
+            if (!items_.empty()) {
+                std::size_t i = 0;
+                while (true) {
+                    const auto first = i * D + 1;
+                    if (first >= items_.size())
+                        break;
+                    auto best = first;
+                    for (auto c = first + 1; c < std::min(first + D, items_.size()); ++c)
+                        if (items_[c].first < items_[best].first)
+                            best = c;
+                    if (!(items_[best].first < item.first))
+                        break;
+                    items_[i] = std::move(items_[best]);
+                    i = best;
+                }
+                items_[i] = std::move(item);
+            }
+            return result;
+        }
+
+        constexpr void clear() noexcept {
+            items_.clear();
+        }
+
+    private:
+        std::vector<std::pair<Cost, V>> items_;
+    };
+
+    /// Picks a radix heap for unsigned integer costs and a d-ary heap otherwise.
+    template <typename V, typename Cost>
+    struct default_queue {
+        using type = dary_heap<V, Cost>;
+    };
+
+    template <typename V, std::unsigned_integral Cost>
+    struct default_queue<V, Cost> {
+        using type = radix_heap<V, Cost>;
+    };
+
+    template <typename V, typename Cost>
+    using default_queue_t = typename default_queue<V, Cost>::type;
+
+    /// Reusable Dijkstra search over arbitrary hashable states.
+    /// `neighbours(state, emit)` calls `emit(next, weight)` for every edge leaving `state`.
+    template <typename State, typename Cost = std::uint64_t, typename Queue = default_queue_t<State, Cost>, typename Hash = std::hash<State>>
+    class dijkstra {
+    public:
+        static constexpr Cost unreachable = std::numeric_limits<Cost>::max();
+
+        dijkstra() = default;
+
+        explicit dijkstra(Queue queue) : queue_{std::move(queue)} {}
+
+        /// Returns the cost from the nearest of `starts` to the first state satisfying `goal`, or `unreachable`.
+        template <std::ranges::input_range Rng, typename Neighbours, std::predicate<const State&> Goal>
+            requires std::convertible_to<std::ranges::range_value_t<Rng>, State>
+        Cost search(const Rng& starts, Neighbours neighbours, Goal goal) {
+            dist_.clear();
+            queue_.clear();
+            for (const auto& start : starts) {
+                if (dist_.try_emplace(start, Cost{}).second)
+                    queue_.push(Cost{}, start);
+            }
+
+            while (!queue_.empty()) {
+                auto [cost, state] = queue_.pop();
+                if (cost > dist_[state])
+                    continue;
+                if (goal(state))
+                    return cost;
+                neighbours(std::as_const(state), [this, cost](const State& next, Cost weight) {
+                    const auto total = static_cast<Cost>(cost + weight);
+                    const auto [it, inserted] = dist_.try_emplace(next, total);
+                    if (inserted || total < it->second) {
+                        it->second = total;
+                        queue_.push(total, next);
+                    }
+                });
+            }
+            return unreachable;
+        }
+
+        template <typename Neighbours, std::predicate<const State&> Goal>
+        Cost search(const State& start, Neighbours neighbours, Goal goal) {
+            return search(std::array{start}, neighbours, goal);
+        }
+
+        /// Finds the cost to every state reachable from `starts`.
+        template <std::ranges::input_range Rng, typename Neighbours>
+            requires std::convertible_to<std::ranges::range_value_t<Rng>, State>
+        void run(const Rng& starts, Neighbours neighbours) {
+            search(starts, neighbours, [](const State&) { return false; });
+        }
+
+        template <typename Neighbours>
+        void run(const State& start, Neighbours neighbours) {
+            run(std::array{start}, neighbours);
+        }
+
+        /// Returns the best cost to `state` found by the last search, or `unreachable`.
+        [[nodiscard]] Cost distance(const State& state) const {
+            const auto it = dist_.find(state);
+            return it == dist_.end() ? unreachable : it->second;
+        }
+
+        [[nodiscard]] const std::unordered_map<State, Cost, Hash>& distances() const noexcept {
+            return dist_;
+        }
+
+    private:
+        Queue queue_;
+        std::unordered_map<State, Cost, Hash> dist_;
+    };
+}   // namespace aoc
+
+#endif  // DIJKSTRA_HPP
@@ -0,0 +1,116 @@
+#ifndef DISTANCE_HPP
+#define DISTANCE_HPP
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <vector>
+#include "bfs.hpp"
+#include "grid.hpp"
+#include "parallel.hpp"
+#include "pos.hpp"
+
+namespace aoc {
+    inline constexpr std::uint32_t infinite_distance = std::numeric_limits<std::uint32_t>::max();
+
+    namespace detail {
+        [[nodiscard]] constexpr std::uint32_t step(std::uint32_t d) noexcept {
+            return d + (d != infinite_distance);
+        }
+    }   // namespace detail
+
+    /// Returns the number of steps from every cell to its nearest source cell, walking only through passable cells.
+    /// Uses one multi-source BFS; cells that cannot reach a source get `infinite_distance`.
+    template <typename Grid, typename Source, typename Pass>
+    [[nodiscard]] grid<std::uint32_t> distance_field(const Grid& g, Source isSource, Pass passable, connectivity conn = connectivity::four) {
+        grid<std::uint32_t> result{g.width(), g.height(), infinite_distance};
+        if (g.empty())
+            return result;
+
+        std::vector<pos<std::size_t>> sources;
+        for (std::size_t y = 0; y < g.height(); ++y)
+            for (std::size_t x = 0; x < g.width(); ++x)
+                if (std::invoke(isSource, g.at(x, y)))
+                    sources.emplace_back(x, y);
+
+        bfs search{g.bounds(), conn};
+        search.run(sources, [&g, &passable](const pos<std::size_t>& p) { return std::invoke(passable, g.at(p)); });
+        for (std::size_t y = 0; y < g.height(); ++y)
+            for (std::size_t x = 0; x < g.width(); ++x)
+                result.at(x, y) = search.distance(pos<std::size_t>{x, y});
+        return result;
+    }
+
+    /// Returns the Manhattan (four) or Chebyshev (eight) distance from every cell to its nearest source cell, ignoring obstacles.
+    /// Manhattan distances are computed separably, one column sweep then one row sweep, each split into bands over `threads` threads (0 for all cores).
+    /// Chebyshev distances use a sequential two-pass 3x3 chamfer.
+    template <typename Grid, typename Source>
+    [[nodiscard]] grid<std::uint32_t> distance_transform(const Grid& g, Source isSource, connectivity conn = connectivity::four, std::size_t threads = 1) {
+        const auto width = g.width();
+        const auto height = g.height();
+        grid<std::uint32_t> result{width, height, infinite_distance};
+        for (std::size_t y = 0; y < height; ++y)
+            for (std::size_t x = 0; x < width; ++x)
+                if (std::invoke(isSource, g.at(x, y)))
+                    result.at(x, y) = 0;
+        if (result.empty())
+            return result;
+
+        auto* d = result.data();
+        if (conn == connectivity::four) {
+            parallel_bands(width, threads, [d, width, height](std::size_t begin, std::size_t end) {
+                for (std::size_t y = 1; y < height; ++y)
+                    for (std::size_t x = begin; x < end; ++x)
+                        d[y * width + x] = std::min(d[y * width + x], detail::step(d[(y - 1) * width + x]));
+                for (std::size_t y = height - 1; y-- > 0;)
+                    for (std::size_t x = begin; x < end; ++x)
+                        d[y * width + x] = std::min(d[y * width + x], detail::step(d[(y + 1) * width + x]));
+            });
+            parallel_bands(height, threads, [d, width](std::size_t begin, std::size_t end) {
+                for (std::size_t y = begin; y < end; ++y) {
+                    auto* row = d + y * width;
+                    for (std::size_t x = 1; x < width; ++x)
+                        row[x] = std::min(row[x], detail::step(row[x - 1]));
+                    for (std::size_t x = width - 1; x-- > 0;)
+                        row[x] = std::min(row[x], detail::step(row[x + 1]));
+                }
+            });
+            return result;
+        }
+
+        for (std::size_t y = 0; y < height; ++y) {
+            for (std::size_t x = 0; x < width; ++x) {
+                auto best = d[y * width + x];
+                if (x > 0)
+                    best = std::min(best, detail::step(d[y * width + x - 1]));
+                if (y > 0) {
+                    best = std::min(best, detail::step(d[(y - 1) * width + x]));
+                    if (x > 0)
+                        best = std::min(best, detail::step(d[(y - 1) * width + x - 1]));
+                    if (x + 1 < width)
+                        best = std::min(best, detail::step(d[(y - 1) * width + x + 1]));
+                }
+                d[y * width + x] = best;
+            }
+        }
+        for (std::size_t y = height; y-- > 0;) {
+            for (std::size_t x = width; x-- > 0;) {
+                auto best = d[y * width + x];
+                if (x + 1 < width)
+                    best = std::min(best, detail::step(d[y * width + x + 1]));
+                if (y + 1 < height) {
+                    best = std::min(best, detail::step(d[(y + 1) * width + x]));
+                    if (x + 1 < width)
+                        best = std::min(best, detail::step(d[(y + 1) * width + x + 1]));
+                    if (x > 0)
+                        best = std::min(best, detail::step(d[(y + 1) * width + x - 1]));
+                }
+                d[y * width + x] = best;
+            }
+        }
+        return result;
+    }
+}   // namespace aoc
+
+#endif  // DISTANCE_HPP
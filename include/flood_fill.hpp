@@ -0,0 +1,90 @@
+#ifndef FLOOD_FILL_HPP
+#define FLOOD_FILL_HPP
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "area.hpp"
+#include "grid.hpp"
+#include "pos.hpp"
+
+namespace aoc {
+    /// Represents the outcome of a flood fill.
+    struct fill_result {
+        std::size_t filled = 0;
+        area<std::size_t> bounds{0};
+    };
+
+    /// Sets every cell connected to `start` through cells satisfying `fillable` to `value`, one horizontal span at a time.
+    /// Only one seed per span is stacked, so large open regions need little memory. `value` itself must not be fillable.
+    template <typename T, typename Layout, std::integral U, std::predicate<const T&> Fillable>
+    fill_result flood_fill(grid<T, Layout>& g, const pos<U>& start, const T& value, Fillable fillable, connectivity conn = connectivity::four) {
+        if (std::invoke(fillable, value))
+            throw std::invalid_argument{"value"};
+        if (!g.has(start))
+            return {};
+
+        const auto width = g.width();
+        const auto height = g.height();
+        const auto canFill = [&g, &fillable](std::size_t x, std::size_t y) { return std::invoke(fillable, std::as_const(g).at(x, y)); };
+        const std::size_t reach = conn == connectivity::eight ? 1 : 0;
+
+        const auto sx = static_cast<std::size_t>(start.x);
+        const auto sy = static_cast<std::size_t>(start.y);
+        fill_result result{0, area<std::size_t>{sx, sy, sx, sy}};
+        std::vector<pos<std::size_t>> seeds{pos<std::size_t>{sx, sy}};
+        while (!seeds.empty()) {
+            const auto [x, y] = seeds.back();
+            seeds.pop_back();
+            if (!canFill(x, y))
+                continue;
+
+            auto left = x;
+            auto right = x;
+            while (left > 0 && canFill(left - 1, y))
+                --left;
+            while (right + 1 < width && canFill(right + 1, y))
+                ++right;
+            if constexpr (std::same_as<Layout, row_major>) {
+                std::fill(g.data() + y * width + left, g.data() + y * width + right + 1, value);
+            } else {
+                for (auto i = left; i <= right; ++i)
+                    g.at(i, y) = value;
+            }
+            result.filled += right - left + 1;
+            result.bounds.min_x = std::min(result.bounds.min_x, left);
+            result.bounds.max_x = std::max(result.bounds.max_x, right);
+            result.bounds.min_y = std::min(result.bounds.min_y, y);
+            result.bounds.max_y = std::max(result.bounds.max_y, y);
+
+            const auto from = left >= reach ? left - reach : 0;
+            const auto to = std::min(right + reach, width - 1);
+            for (const auto ny : {y - 1, y + 1}) {
+                if (ny >= height)
+                    continue;
+                bool inRun = false;
+                for (auto i = from; i <= to; ++i) {
+                    const bool open = canFill(i, ny);
+                    if (open && !inRun)
+                        seeds.emplace_back(i, ny);
+                    inRun = open;
+                }
+            }
+        }
+        return result;
+    }
+
+    /// Replaces the region of cells equal to the one at `start` with `value`.
+    template <typename T, typename Layout, std::integral U>
+    fill_result flood_fill(grid<T, Layout>& g, const pos<U>& start, const T& value, connectivity conn = connectivity::four) {
+        if (!g.has(start) || g.at(start) == value)
+            return {};
+        const auto target = g.at(start);
+        return flood_fill(g, start, value, [&target](const T& cell) { return cell == target; }, conn);
+    }
+}   // namespace aoc
+
+#endif  // FLOOD_FILL_HPP
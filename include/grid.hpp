@@ -0,0 +1,231 @@
+#ifndef GRID_HPP
+#define GRID_HPP
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <ranges>
+#include <stdexcept>
+#include <vector>
+#include "area.hpp"
+#include "pos.hpp"
+
+namespace aoc {
+    /// Which cells count as adjacent: edge neighbours only, or edge and diagonal neighbours.
+    enum class connectivity { four, eight };
+
+    /// Compass directions on a grid as read from text, where north points towards row 0 (decreasing y) and south towards larger y.
+    /// This is the opposite of `pos`, whose `up()` increases y, and of `area::top_left()`, which sits at `max_y`:
+    /// `direction::north` moves the way of `pos::down()`.
+    enum class direction { north, east, south, west };
+
+    namespace detail {
+        /// Calls `func(n)` for each in-bounds row-major neighbour index of cell `i`, stopping as soon as it returns true.
+        template <typename Func>
+        constexpr bool any_neighbour(std::size_t i, std::size_t width, std::size_t height, connectivity conn, Func&& func) {
+            const auto x = i % width;
+            const auto y = i / width;
+            const bool left = x > 0;
+            const bool right = x + 1 < width;
+            const bool down = y > 0;
+            const bool up = y + 1 < height;
+            if ((right && func(i + 1)) || (left && func(i - 1)) || (up && func(i + width)) || (down && func(i - width)))
+                return true;
+            return conn == connectivity::eight
+                && ((right && up && func(i + width + 1)) || (right && down && func(i - width + 1)) || (left && up && func(i + width - 1)) || (left && down && func(i - width - 1)));
+        }
+    }   // namespace detail
+
+    /// Stores cells row by row.
+    struct row_major {
+        std::size_t width;
+        std::size_t height;
+
+        constexpr explicit row_major(std::size_t width, std::size_t height) noexcept : width{width}, height{height} {}
+
+        [[nodiscard]] constexpr std::size_t size() const noexcept {
+            return width * height;
+        }
+
+        [[nodiscard]] constexpr std::size_t index(std::size_t x, std::size_t y) const noexcept {
+            return y * width + x;
+        }
+    };
+
+    /// Stores cells in square tiles of `2^TileBits` cells per side, optionally Morton-ordered within each tile.
+    template <std::size_t TileBits = 3, bool Morton = false> requires (TileBits > 0 && TileBits <= 8)
+    struct tiled {
+        static constexpr std::size_t tile = std::size_t{1} << TileBits;
+
+        std::size_t width;
+        std::size_t height;
+        std::size_t tiles_x;
+
+        constexpr explicit tiled(std::size_t width, std::size_t height) noexcept : width{width}, height{height}, tiles_x{(width + tile - 1) >> TileBits} {}
+
+        [[nodiscard]] constexpr std::size_t size() const noexcept {
+            return tiles_x * ((height + tile - 1) >> TileBits) * tile * tile;
+        }
+
+        [[nodiscard]] constexpr std::size_t index(std::size_t x, std::size_t y) const noexcept {
+            const auto base = ((y >> TileBits) * tiles_x + (x >> TileBits)) << (2 * TileBits);
+            const auto lx = x & (tile - 1);
+            const auto ly = y & (tile - 1);
+            if constexpr (Morton)
+                return base | spread(lx) | spread(ly) << 1;
+            else
+                return base | ly << TileBits | lx;
+        }
+
+    private:
+        [[nodiscard]] static constexpr std::size_t spread(std::size_t v) noexcept {
+            v = (v | v << 4) & 0x0F0F;
+            v = (v | v << 2) & 0x3333;
+            return (v | v << 1) & 0x5555;
+        }
+    };
+
+    /// Represents a fixed-size 2D grid of cells, where `pos{x, y}` is column `x` of row `y`.
+    template <typename T, typename Layout = row_major>
+    class grid {
+    public:
+        using value_type = T;
+        using layout_type = Layout;
+
+        constexpr grid() : grid{0, 0} {}
+
+        constexpr explicit grid(std::size_t width, std::size_t height, const T& value = T{}) : layout_{width, height}, cells_(layout_.size(), value) {}
+
+        template <std::ranges::random_access_range Rng>
+        [[nodiscard]] static grid from_lines(const Rng& lines) {
+            const std::size_t height = std::ranges::size(lines);
+            const std::size_t width = height == 0 ? 0 : std::ranges::size(lines[0]);
+            grid result{width, height};
+            for (std::size_t y = 0; y < height; ++y) {
+                if (std::ranges::size(lines[y]) != width)
+                    throw std::invalid_argument{"lines"};
+                for (std::size_t x = 0; x < width; ++x)
+                    result.at(x, y) = static_cast<T>(lines[y][x]);
+            }
+            return result;
+        }
+
+        [[nodiscard]] constexpr std::size_t width() const noexcept {
+            return layout_.width;
+        }
+
+        [[nodiscard]] constexpr std::size_t height() const noexcept {
+            return layout_.height;
+        }
+
+        [[nodiscard]] constexpr std::size_t size() const noexcept {
+            return layout_.width * layout_.height;
+        }
+
+        [[nodiscard]] constexpr bool empty() const noexcept {
+            return size() == 0;
+        }
+
+        /// Returns the area of the cells, throwing `std::out_of_range` for an empty grid since an area always holds a cell.
+        [[nodiscard]] constexpr area<std::size_t> bounds() const {
+            if (empty())
+                throw std::out_of_range{"bounds"};
+            return area<std::size_t>{width() - 1, height() - 1};
+        }
+
+        [[nodiscard]] constexpr const Layout& layout() const noexcept {
+            return layout_;
+        }
+
+        [[nodiscard]] constexpr std::size_t index(std::size_t x, std::size_t y) const noexcept {
+            return layout_.index(x, y);
+        }
+
+        template <std::integral U>
+        [[nodiscard]] constexpr std::size_t index(const pos<U>& p) const noexcept {
+            return layout_.index(static_cast<std::size_t>(p.x), static_cast<std::size_t>(p.y));
+        }
+
+        template <std::integral U>
+        [[nodiscard]] constexpr bool has(const pos<U>& p) const noexcept {
+            return static_cast<std::size_t>(p.x) < width() && static_cast<std::size_t>(p.y) < height();
+        }
+
+        [[nodiscard]] constexpr T& at(std::size_t x, std::size_t y) noexcept {
+            return cells_[layout_.index(x, y)];
+        }
+
+        [[nodiscard]] constexpr const T& at(std::size_t x, std::size_t y) const noexcept {
+            return cells_[layout_.index(x, y)];
+        }
+
+        template <std::integral U>
+        [[nodiscard]] constexpr T& at(const pos<U>& p) noexcept {
+            return cells_[index(p)];
+        }
+
+        template <std::integral U>
+        [[nodiscard]] constexpr const T& at(const pos<U>& p) const noexcept {
+            return cells_[index(p)];
+        }
+
+        template <std::integral U>
+        [[nodiscard]] constexpr T& operator[](const pos<U>& p) noexcept {
+            return cells_[index(p)];
+        }
+
+        template <std::integral U>
+        [[nodiscard]] constexpr const T& operator[](const pos<U>& p) const noexcept {
+            return cells_[index(p)];
+        }
+
+        constexpr void fill(const T& value) {
+            std::ranges::fill(cells_, value);
+        }
+
+        /// Raw storage in layout order, which may include padding cells for tiled layouts.
+        [[nodiscard]] constexpr T* data() noexcept {
+            return cells_.data();
+        }
+
+        [[nodiscard]] constexpr const T* data() const noexcept {
+            return cells_.data();
+        }
+
+        [[nodiscard]] constexpr auto begin() noexcept requires std::same_as<Layout, row_major> {
+            return cells_.begin();
+        }
+
+        [[nodiscard]] constexpr auto begin() const noexcept requires std::same_as<Layout, row_major> {
+            return cells_.begin();
+        }
+
+        [[nodiscard]] constexpr auto end() noexcept requires std::same_as<Layout, row_major> {
+            return cells_.end();
+        }
+
+        [[nodiscard]] constexpr auto end() const noexcept requires std::same_as<Layout, row_major> {
+            return cells_.end();
+        }
+
+        [[nodiscard]] constexpr bool operator==(const grid& rhs) const {
+            if (width() != rhs.width() || height() != rhs.height())
+                return false;
+            if constexpr (std::same_as<Layout, row_major>)
+                return cells_ == rhs.cells_;
+            for (std::size_t y = 0; y < height(); ++y)
+                for (std::size_t x = 0; x < width(); ++x)
+                    if (at(x, y) != rhs.at(x, y))
+                        return false;
+            return true;
+        }
+
+    private:
+        Layout layout_;
+        std::vector<T> cells_;
+    };
+
+    template <typename T>
+    using tiled_grid = grid<T, tiled<>>;
+}   // namespace aoc
+
+#endif  // GRID_HPP
@@ -0,0 +1,404 @@
+#ifndef HASHLIFE_HPP
+#define HASHLIFE_HPP
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ranges>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+#include "area.hpp"
+#include "grid.hpp"
+#include "life.hpp"
+#include "pos.hpp"
+
+namespace aoc {
+    /// Life-like cellular automaton on an unbounded plane stored as a hash-consed quadtree, advanced with Gosper's Hashlife.
+    /// Identical squares share one node, and each node remembers its centre advanced by a power of two generations,
+    /// so regular patterns can be run for astronomically many generations. Children are indexed by `y * 2 + x` within their parent.
+    /// The root is at most `max_level` levels tall, so cells must lie in `[-2^61, 2^61)` on both axes.
+    class hashlife {
+    public:
+        using coord_type = long long;
+        static constexpr std::size_t default_max_nodes = std::size_t{1} << 22;
+        static constexpr std::uint32_t max_level = 62;
+
+        /// Once more than `maxNodes` nodes exist, every node the pattern no longer uses is dropped, along with all memoised results.
+        /// A jump that would pass the limit midway is abandoned and redone as two jumps of half the length. When the pattern alone takes more
+        /// than half the limit, a jump may grow the table to twice the pattern instead, and single generations are never split, so stepping always progresses.
+        /// The rule may not give birth to cells with no live neighbours, since that would fill the plane.
+        explicit hashlife(life_rule rule = life_rule{}, std::size_t maxNodes = default_max_nodes) : rule_{rule}, max_nodes_{maxNodes} {
+            if (rule.birth() & 1)
+                throw std::invalid_argument{"rule"};
+            nodes_ = {node{}, node{{}, 0, 1}};
+            root_ = empty(3);
+        }
+
+        /// Creates an automaton from a grid, where the cells satisfying `alive` start alive and `pos{x, y}` of the grid is `pos{x, y}` of the plane.
+        template <typename Grid, typename Alive>
+        [[nodiscard]] static hashlife from_grid(const Grid& g, Alive alive, life_rule rule = life_rule{}, std::size_t maxNodes = default_max_nodes) {
+            hashlife result{rule, maxNodes};
+            for (std::size_t y = 0; y < g.height(); ++y)
+                for (std::size_t x = 0; x < g.width(); ++x)
+                    if (alive(g.at(x, y)))
+                        result.set(pos{static_cast<coord_type>(x), static_cast<coord_type>(y)});
+            return result;
+        }
+
+        /// Creates an automaton whose live cells are `cells`.
+        template <std::ranges::input_range Rng>
+        [[nodiscard]] static hashlife from_cells(const Rng& cells, life_rule rule = life_rule{}, std::size_t maxNodes = default_max_nodes) {
+            hashlife result{rule, maxNodes};
+            for (const auto& p : cells)
+                result.set(pos{static_cast<coord_type>(p.x), static_cast<coord_type>(p.y)});
+            return result;
+        }
+
+        [[nodiscard]] constexpr const life_rule& rule() const noexcept {
+            return rule_;
+        }
+
+        /// Number of generations advanced so far.
+        [[nodiscard]] constexpr std::uint64_t generation() const noexcept {
+            return generation_;
+        }
+
+        [[nodiscard]] std::uint64_t population() const noexcept {
+            return nodes_[root_].population;
+        }
+
+        /// Number of quadtree nodes currently stored, including memoised results.
+        [[nodiscard]] constexpr std::size_t nodes() const noexcept {
+            return nodes_.size();
+        }
+
+        [[nodiscard]] bool test(const pos<coord_type>& p) const noexcept {
+            if (!inside(p))
+                return false;
+            auto id = root_;
+            auto x = p.x + half(root_);
+            auto y = p.y + half(root_);
+            while (nodes_[id].level > 0) {
+                const auto h = half(id);
+                id = nodes_[id].children[static_cast<std::size_t>((y >= h) << 1 | (x >= h))];
+                x %= h;
+                y %= h;
+            }
+            return id == alive_leaf;
+        }
+
+        void set(const pos<coord_type>& p, bool alive = true) {
+            while (!inside(p)) {
+                if (nodes_[root_].level >= max_level)
+                    throw std::out_of_range{"p"};
+                root_ = expand(root_);
+            }
+            root_ = set(root_, p.x + half(root_), p.y + half(root_), alive);
+        }
+
+        /// Calls `func(p)` for every live cell.
+        template <typename Func>
+        void for_each(Func&& func) const {
+            visit(root_, -half(root_), -half(root_), func);
+        }
+
+        [[nodiscard]] std::vector<pos<coord_type>> cells() const {
+            std::vector<pos<coord_type>> result;
+            result.reserve(static_cast<std::size_t>(population()));
+            for_each([&result](const pos<coord_type>& p) { result.push_back(p); });
+            return result;
+        }
+
+        /// Returns the cells of `region` as a grid of `dead` and `alive` values, where `pos{0, 0}` of the grid is the region's minimum corner.
+        template <typename T>
+        [[nodiscard]] grid<T> to_grid(const area<coord_type>& region, T alive, T dead) const {
+            grid<T> result{static_cast<std::size_t>(region.cols()), static_cast<std::size_t>(region.rows()), dead};
+            const auto mark = [&](const pos<coord_type>& p) {
+                result.at(static_cast<std::size_t>(p.x - region.min_x), static_cast<std::size_t>(p.y - region.min_y)) = alive;
+            };
+            visit(root_, -half(root_), -half(root_), mark, &region);
+            return result;
+        }
+
+        /// Returns the smallest area holding every live cell, which is a single cell at the origin when there are none.
+        [[nodiscard]] area<coord_type> bounds() const {
+            if (population() == 0)
+                return area<coord_type>{0};
+            std::unordered_map<std::uint32_t, box> boxes;
+            const auto b = bounding_box(root_, boxes);
+            const auto origin = -half(root_);
+            return area<coord_type>{origin + b[2], origin + b[3], origin + b[0], origin + b[1]};
+        }
+
+        /// Advances the automaton by `generations` steps, as one jump per set bit.
+        /// Throws `std::out_of_range` when `generations` reaches 2^61, or when a jump would carry the pattern out of the coordinate range;
+        /// jumps already made by the call then stay applied.
+        void step(std::uint64_t generations = 1) {
+            if (generations >> (max_level - 1) != 0)
+                throw std::out_of_range{"generations"};
+            for (std::size_t k = 0; k < 64; ++k)
+                if (generations >> k & 1)
+                    jump(k);
+        }
+
+        /// Drops every node the current pattern does not use, and every memoised result.
+        void collect() {
+            auto old = std::move(nodes_);
+            table_.clear();
+            empty_.clear();
+            nodes_ = {old[dead_leaf], old[alive_leaf]};
+            std::vector<std::uint32_t> remap(old.size(), npos);
+            remap[dead_leaf] = dead_leaf;
+            remap[alive_leaf] = alive_leaf;
+            root_ = copy(root_, old, remap);
+        }
+
+    private:
+        static constexpr std::uint32_t npos = std::numeric_limits<std::uint32_t>::max();
+        static constexpr std::uint32_t dead_leaf = 0;
+        static constexpr std::uint32_t alive_leaf = 1;
+
+        /// Holds the minimum x and y, then the maximum x and y, of the live cells in a node relative to its corner.
+        using box = std::array<coord_type, 4>;
+
+        struct node {
+            std::array<std::uint32_t, 4> children{};
+            std::uint32_t level = 0;
+            std::uint64_t population = 0;
+            std::uint32_t result = npos;
+            std::uint32_t result_log = 0;
+        };
+
+        struct children_hash {
+            [[nodiscard]] std::size_t operator()(const std::array<std::uint32_t, 4>& c) const noexcept {
+                const auto lo = static_cast<std::uint64_t>(c[0]) << 32 | c[1];
+                const auto hi = static_cast<std::uint64_t>(c[2]) << 32 | c[3];
+                return static_cast<std::size_t>((lo * 0x9E3779B97F4A7C15ULL) ^ (hi * 0xC2B2AE3D27D4EB4FULL) ^ (hi >> 29));
+            }
+        };
+
+        life_rule rule_;
+        std::size_t max_nodes_;
+        std::vector<node> nodes_;
+        std::unordered_map<std::array<std::uint32_t, 4>, std::uint32_t, children_hash> table_;
+        std::vector<std::uint32_t> empty_;
+        std::uint32_t root_ = 0;
+        std::uint64_t generation_ = 0;
+        std::size_t budget_ = 0;
+        bool aborted_ = false;
+
+        [[nodiscard]] coord_type half(std::uint32_t id) const noexcept {
+            return coord_type{1} << (nodes_[id].level - 1);
+        }
+
+        [[nodiscard]] bool inside(const pos<coord_type>& p) const noexcept {
+            const auto h = half(root_);
+            return p.x >= -h && p.x < h && p.y >= -h && p.y < h;
+        }
+
+        /// Returns the one node with these children, creating it if needed.
+        std::uint32_t make(const std::array<std::uint32_t, 4>& children) {
+            const auto [it, inserted] = table_.try_emplace(children, static_cast<std::uint32_t>(nodes_.size()));
+            if (inserted) {
+                std::uint64_t population = 0;
+                for (const auto c : children)
+                    population += nodes_[c].population;
+                nodes_.push_back(node{children, nodes_[children[0]].level + 1, population});
+            }
+            return it->second;
+        }
+
+        std::uint32_t make(std::uint32_t a, std::uint32_t b, std::uint32_t c, std::uint32_t d) {
+            return make(std::array{a, b, c, d});
+        }
+
+        std::uint32_t empty(std::uint32_t level) {
+            if (empty_.empty())
+                empty_.push_back(dead_leaf);
+            while (empty_.size() <= level) {
+                const auto e = empty_.back();
+                empty_.push_back(make(e, e, e, e));
+            }
+            return empty_[level];
+        }
+
+        /// Returns a node one level up with `id` in its centre and empty space around it.
+        std::uint32_t expand(std::uint32_t id) {
+            const auto e = empty(nodes_[id].level - 1);
+            const auto c = nodes_[id].children;
+            return make(make(e, e, e, c[0]), make(e, e, c[1], e), make(e, c[2], e, e), make(c[3], e, e, e));
+        }
+
+        /// Returns whether every live cell lies in the central half of the node.
+        [[nodiscard]] bool padded(std::uint32_t id) const noexcept {
+            const auto& c = nodes_[id].children;
+            for (std::size_t i = 0; i < 4; ++i)
+                if (nodes_[c[i]].population != nodes_[nodes_[c[i]].children[3 - i]].population)
+                    return false;
+            return true;
+        }
+
+        std::uint32_t set(std::uint32_t id, coord_type x, coord_type y, bool alive) {
+            if (nodes_[id].level == 0)
+                return alive ? alive_leaf : dead_leaf;
+            const auto h = half(id);
+            auto children = nodes_[id].children;
+            auto& child = children[static_cast<std::size_t>((y >= h) << 1 | (x >= h))];
+            child = set(child, x % h, y % h, alive);
+            return make(children);
+        }
+
+        /// Returns the central half of a node of level 2 or more.
+        std::uint32_t centre(std::uint32_t id) {
+            const auto c = nodes_[id].children;
+            return make(nodes_[c[0]].children[3], nodes_[c[1]].children[2], nodes_[c[2]].children[1], nodes_[c[3]].children[0]);
+        }
+
+        /// Advances the 4x4 cells of a level 2 node by one generation and returns its central 2x2 cells.
+        std::uint32_t advance_leaves(std::uint32_t id) {
+            const auto cell = [&](int x, int y) -> unsigned {
+                const auto quarter = nodes_[id].children[static_cast<std::size_t>((y >> 1) << 1 | (x >> 1))];
+                return nodes_[quarter].children[static_cast<std::size_t>((y & 1) << 1 | (x & 1))] == alive_leaf;
+            };
+            std::array<std::uint32_t, 4> result{};
+            for (int y = 1; y <= 2; ++y) {
+                for (int x = 1; x <= 2; ++x) {
+                    unsigned count = 0;
+                    for (int dy = -1; dy <= 1; ++dy)
+                        for (int dx = -1; dx <= 1; ++dx)
+                            count += (dx != 0 || dy != 0) ? cell(x + dx, y + dy) : 0;
+                    result[static_cast<std::size_t>((y - 1) << 1 | (x - 1))] = rule_.next(cell(x, y), count) ? alive_leaf : dead_leaf;
+                }
+            }
+            return make(result);
+        }
+
+        /// Returns the central half of a node of level `L` advanced by `2^k` generations, where `k <= L - 2`.
+        /// Gives up and returns `npos` once the node table outgrows the jump's budget.
+        std::uint32_t successor(std::uint32_t id, std::uint32_t k) {
+            const auto level = nodes_[id].level;
+            if (nodes_[id].population == 0)
+                return empty(level - 1);
+            if (nodes_[id].result != npos && nodes_[id].result_log == k)
+                return nodes_[id].result;
+            if (nodes_.size() > budget_) {
+                aborted_ = true;
+                return npos;
+            }
+
+            std::uint32_t result = 0;
+            if (level == 2) {
+                result = advance_leaves(id);
+            } else {
+                // nine overlapping squares of half the size, in rows, built from the grandchildren
+                const auto [a, b, c, d] = nodes_[id].children;
+                const auto ga = nodes_[a].children;
+                const auto gb = nodes_[b].children;
+                const auto gc = nodes_[c].children;
+                const auto gd = nodes_[d].children;
+                const std::array<std::uint32_t, 9> squares{
+                    a, make(ga[1], gb[0], ga[3], gb[2]), b,
+                    make(ga[2], ga[3], gc[0], gc[1]), make(ga[3], gb[2], gc[1], gd[0]), make(gb[2], gb[3], gd[0], gd[1]),
+                    c, make(gc[1], gd[0], gc[3], gd[2]), d,
+                };
+
+                // at full speed both halves of the jump advance time, otherwise only the second does
+                const bool full = k == level - 2;
+                std::array<std::uint32_t, 9> r{};
+                for (std::size_t i = 0; i < 9; ++i) {
+                    r[i] = full ? successor(squares[i], level - 3) : centre(squares[i]);
+                    if (aborted_)
+                        return npos;
+                }
+                const auto next = full ? level - 3 : k;
+                const std::array<std::array<std::size_t, 4>, 4> quads{{{0, 1, 3, 4}, {1, 2, 4, 5}, {3, 4, 6, 7}, {4, 5, 7, 8}}};
+                std::array<std::uint32_t, 4> quarters{};
+                for (std::size_t i = 0; i < 4; ++i) {
+                    quarters[i] = successor(make(r[quads[i][0]], r[quads[i][1]], r[quads[i][2]], r[quads[i][3]]), next);
+                    if (aborted_)
+                        return npos;
+                }
+                result = make(quarters);
+            }
+            nodes_[id].result = result;
+            nodes_[id].result_log = k;
+            return result;
+        }
+
+        void jump(std::size_t k) {
+            while (nodes_[root_].level < k + 2 || !padded(root_)) {
+                if (nodes_[root_].level >= max_level)
+                    throw std::out_of_range{"generations"};
+                root_ = expand(root_);
+            }
+            if (nodes_.size() > max_nodes_)
+                collect();
+            budget_ = k == 0 ? std::numeric_limits<std::size_t>::max() : std::max(max_nodes_, nodes_.size() * 2);
+            aborted_ = false;
+            const auto next = successor(expand(root_), static_cast<std::uint32_t>(k));
+            if (aborted_) {
+                collect();
+                jump(k - 1);
+                jump(k - 1);
+                return;
+            }
+            root_ = next;
+            generation_ += std::uint64_t{1} << k;
+            if (nodes_.size() > max_nodes_)
+                collect();
+        }
+
+        std::uint32_t copy(std::uint32_t id, const std::vector<node>& old, std::vector<std::uint32_t>& remap) {
+            if (remap[id] == npos) {
+                std::array<std::uint32_t, 4> children{};
+                for (std::size_t i = 0; i < 4; ++i)
+                    children[i] = copy(old[id].children[i], old, remap);
+                remap[id] = make(children);
+            }
+            return remap[id];
+        }
+
+        /// Calls `func` for every live cell of a node whose minimum corner is `(x, y)`, skipping nodes that miss `clip` when one is given.
+        template <typename Func>
+        void visit(std::uint32_t id, coord_type x, coord_type y, Func& func, const area<coord_type>* clip = nullptr) const {
+            const auto& n = nodes_[id];
+            if (n.population == 0)
+                return;
+            const auto size = coord_type{1} << n.level;
+            if (clip != nullptr && (x > clip->max_x || y > clip->max_y || x + size - 1 < clip->min_x || y + size - 1 < clip->min_y))
+                return;
+            if (n.level == 0) {
+                func(pos{x, y});
+                return;
+            }
+            const auto h = size / 2;
+            for (std::size_t i = 0; i < 4; ++i)
+                visit(n.children[i], x + static_cast<coord_type>(i & 1) * h, y + static_cast<coord_type>(i >> 1) * h, func, clip);
+        }
+
+        /// Returns the bounding box of a non-empty node, memoised so shared subtrees are measured once.
+        box bounding_box(std::uint32_t id, std::unordered_map<std::uint32_t, box>& boxes) const {
+            const auto& n = nodes_[id];
+            if (n.level == 0)
+                return box{0, 0, 0, 0};
+            if (const auto it = boxes.find(id); it != boxes.end())
+                return it->second;
+            const auto h = coord_type{1} << (n.level - 1);
+            box result{std::numeric_limits<coord_type>::max(), std::numeric_limits<coord_type>::max(), std::numeric_limits<coord_type>::min(), std::numeric_limits<coord_type>::min()};
+            for (std::size_t i = 0; i < 4; ++i) {
+                if (nodes_[n.children[i]].population == 0)
+                    continue;
+                const auto b = bounding_box(n.children[i], boxes);
+                const auto dx = static_cast<coord_type>(i & 1) * h;
+                const auto dy = static_cast<coord_type>(i >> 1) * h;
+                result = box{std::min(result[0], b[0] + dx), std::min(result[1], b[1] + dy), std::max(result[2], b[2] + dx), std::max(result[3], b[3] + dy)};
+            }
+            boxes.emplace(id, result);
+            return result;
+        }
+    };
+}   // namespace aoc
+
+#endif  // HASHLIFE_HPP
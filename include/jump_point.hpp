@@ -0,0 +1,337 @@
+#ifndef JUMP_POINT_HPP
+#define JUMP_POINT_HPP
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+#include "area.hpp"
+#include "bitset.hpp"
+#include "dijkstra.hpp"
+#include "grid.hpp"
+#include "pos.hpp"
+
+namespace aoc {
+    namespace detail {
+        /// Passability stored one bit per cell along each line of a grid, with a blocked border around it so scans always stop.
+        /// Line `l` and offset `i` are border-padded, so cell `(x, y)` of the grid is line `y + 1`, offset `x + 1`.
+        class line_bits {
+        public:
+            static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+            line_bits() = default;
+
+            explicit line_bits(std::size_t lines, std::size_t length)
+                : stride_{(length + 2 + bitset::word_bits - 1) / bitset::word_bits}, bits_{(lines + 2) * stride_ * bitset::word_bits} {}
+
+            [[nodiscard]] bool test(std::size_t line, std::size_t i) const noexcept {
+                return bits_.test(line * stride_ * bitset::word_bits + i);
+            }
+
+            void assign(std::size_t line, std::size_t i, bool value) noexcept {
+                const auto bit = line * stride_ * bitset::word_bits + i;
+                if (value)
+                    bits_.set(bit);
+                else
+                    bits_.reset(bit);
+            }
+
+            /// Returns the first offset past `from` where a jump must stop: `target`, or a cell whose side opens up so a turn is forced.
+            /// Returns `npos` if a blocked cell comes first. Eight-connected lines stop where a side cell is blocked but the next one is not,
+            /// four-connected lines where a side cell is open but the previous one was blocked.
+            [[nodiscard]] std::size_t scan(std::size_t line, std::size_t from, bool forward, connectivity conn, std::size_t target) const noexcept {
+                const auto first = static_cast<std::ptrdiff_t>(from / bitset::word_bits);
+                for (auto k = first;; k += forward ? 1 : -1) {
+                    auto stops = ~word(line, k);
+                    for (const auto side : {line - 1, line + 1}) {
+                        const auto w = word(side, k);
+                        stops |= conn == connectivity::eight ? ~w & shifted(side, k, forward) : w & ~shifted(side, k, !forward);
+                    }
+                    if (target != npos && static_cast<std::ptrdiff_t>(target / bitset::word_bits) == k)
+                        stops |= bitset::word_type{1} << (target % bitset::word_bits);
+                    if (k == first)
+                        stops &= forward ? ~bitset::word_type{0} << (from % bitset::word_bits) << 1 : (bitset::word_type{1} << (from % bitset::word_bits)) - 1;
+                    if (stops != 0) {
+                        const auto bit = forward ? std::countr_zero(stops) : bitset::word_bits - 1 - std::countl_zero(stops);
+                        const auto i = static_cast<std::size_t>(k) * bitset::word_bits + static_cast<std::size_t>(bit);
+                        return test(line, i) ? i : npos;
+                    }
+                }
+            }
+
+        private:
+            std::size_t stride_ = 0;
+            bitset bits_;
+
+            [[nodiscard]] bitset::word_type word(std::size_t line, std::ptrdiff_t k) const noexcept {
+                if (k < 0 || static_cast<std::size_t>(k) >= stride_)
+                    return 0;
+                return bits_.data()[line * stride_ + static_cast<std::size_t>(k)];
+            }
+
+            /// Returns word `k` of a line moved so that each offset holds the bit of its next (`ahead`) or previous neighbour.
+            [[nodiscard]] bitset::word_type shifted(std::size_t line, std::ptrdiff_t k, bool ahead) const noexcept {
+                if (ahead)
+                    return word(line, k) >> 1 | word(line, k + 1) << (bitset::word_bits - 1);
+                return word(line, k) << 1 | word(line, k - 1) >> (bitset::word_bits - 1);
+            }
+        };
+    }   // namespace detail
+
+    /// Jump point search for uniform-cost moves over the cells of an area, returning the same distances as `bfs`.
+    /// Passability is captured once as row and column bitboards, so straight jumps test 64 cells per step.
+    /// `passable` is called with the cell's `pos<T>` when it accepts one, otherwise with its row-major index within the area.
+    template <std::integral T = std::size_t>
+    class jump_point_search {
+    public:
+        static constexpr std::uint32_t unreachable = std::numeric_limits<std::uint32_t>::max();
+
+        template <typename Pass>
+        explicit jump_point_search(const area<T>& bounds, Pass passable, connectivity conn = connectivity::four)
+            : bounds_{bounds}, width_{static_cast<std::size_t>(bounds.cols())}, height_{static_cast<std::size_t>(bounds.rows())}, conn_{conn},
+              rows_{height_, width_}, cols_{width_, height_}, seen_{width_ * height_}, closed_{width_ * height_}, g_(width_ * height_), parents_(width_ * height_) {
+            for (std::size_t i = 0; i < width_ * height_; ++i) {
+                if constexpr (std::predicate<Pass&, pos<T>>)
+                    set_passable(position(i), passable(position(i)));
+                else
+                    set_passable(position(i), passable(i));
+            }
+        }
+
+        [[nodiscard]] constexpr const area<T>& bounds() const noexcept {
+            return bounds_;
+        }
+
+        [[nodiscard]] bool passable(const pos<T>& p) const noexcept {
+            return bounds_.has(p) && open(static_cast<std::ptrdiff_t>(p.x - bounds_.min_x), static_cast<std::ptrdiff_t>(p.y - bounds_.min_y));
+        }
+
+        void set_passable(const pos<T>& p, bool value) noexcept {
+            const auto x = static_cast<std::size_t>(p.x - bounds_.min_x);
+            const auto y = static_cast<std::size_t>(p.y - bounds_.min_y);
+            rows_.assign(y + 1, x + 1, value);
+            cols_.assign(x + 1, y + 1, value);
+        }
+
+        /// Returns the distance from `start` to `goal`, or `unreachable`. Like `bfs::search`, the start is trusted but the goal must be passable.
+        std::uint32_t search(const pos<T>& start, const pos<T>& goal) {
+            seen_.clear();
+            closed_.clear();
+            open_.clear();
+            expanded_ = 0;
+            goal_ = npos;
+            if (!bounds_.has(start) || !bounds_.has(goal) || (start != goal && !passable(goal)))
+                return unreachable;
+
+            goal_ = index(goal);
+            const auto push = [&](std::size_t i, std::uint32_t g) {
+                open_.push({g + heuristic(i), unreachable - g}, i);
+            };
+
+            const auto startIndex = index(start);
+            seen_.set(startIndex);
+            g_[startIndex] = 0;
+            parents_[startIndex] = startIndex;
+            push(startIndex, 0);
+            while (!open_.empty()) {
+                const auto [key, i] = open_.pop();
+                const auto g = unreachable - key.second;
+                if (g != g_[i] || closed_.test_and_set(i))
+                    continue;
+                ++expanded_;
+                if (i == goal_)
+                    return g;
+
+                successors(i, [&](std::size_t n) {
+                    const auto ng = g + steps(i, n);
+                    if (seen_.test_and_set(n) && ng >= g_[n])
+                        return;
+                    g_[n] = ng;
+                    parents_[n] = i;
+                    closed_.reset(n);
+                    push(n, ng);
+                });
+            }
+            goal_ = npos;
+            return unreachable;
+        }
+
+        /// Number of jump points expanded by the last search.
+        [[nodiscard]] constexpr std::size_t expanded() const noexcept {
+            return expanded_;
+        }
+
+        /// Returns the jump points on the path found by the last search, start and goal included, or an empty list.
+        [[nodiscard]] std::vector<pos<T>> jump_points() const {
+            std::vector<pos<T>> result;
+            if (goal_ == npos)
+                return result;
+            for (auto i = goal_;; i = parents_[i]) {
+                result.push_back(position(i));
+                if (parents_[i] == i)
+                    break;
+            }
+            std::ranges::reverse(result);
+            return result;
+        }
+
+        /// Returns every cell on the path found by the last search, or an empty path.
+        [[nodiscard]] std::vector<pos<T>> path() const {
+            const auto points = jump_points();
+            std::vector<pos<T>> result;
+            for (std::size_t j = 0; j < points.size(); ++j) {
+                if (j == 0) {
+                    result.push_back(points[j]);
+                    continue;
+                }
+                auto p = points[j - 1];
+                const auto dx = static_cast<T>((points[j].x > p.x) - (points[j].x < p.x));
+                const auto dy = static_cast<T>((points[j].y > p.y) - (points[j].y < p.y));
+                while (p != points[j]) {
+                    p = pos<T>{static_cast<T>(p.x + dx), static_cast<T>(p.y + dy)};
+                    result.push_back(p);
+                }
+            }
+            return result;
+        }
+
+    private:
+        static constexpr std::size_t npos = detail::line_bits::npos;
+
+        area<T> bounds_;
+        std::size_t width_;
+        std::size_t height_;
+        connectivity conn_;
+        detail::line_bits rows_;
+        detail::line_bits cols_;
+        bitset seen_;
+        bitset closed_;
+        std::vector<std::uint32_t> g_;
+        std::vector<std::size_t> parents_;
+        dary_heap<std::size_t, std::pair<std::uint32_t, std::uint32_t>> open_;
+        std::size_t goal_ = npos;
+        std::size_t expanded_ = 0;
+
+        [[nodiscard]] constexpr std::size_t index(const pos<T>& p) const noexcept {
+            return static_cast<std::size_t>(p.y - bounds_.min_y) * width_ + static_cast<std::size_t>(p.x - bounds_.min_x);
+        }
+
+        [[nodiscard]] constexpr pos<T> position(std::size_t i) const noexcept {
+            return pos<T>{static_cast<T>(bounds_.min_x + static_cast<T>(i % width_)), static_cast<T>(bounds_.min_y + static_cast<T>(i / width_))};
+        }
+
+        /// Cells one step outside the area read as blocked.
+        [[nodiscard]] bool open(std::ptrdiff_t x, std::ptrdiff_t y) const noexcept {
+            return rows_.test(static_cast<std::size_t>(y + 1), static_cast<std::size_t>(x + 1));
+        }
+
+        [[nodiscard]] std::uint32_t steps(std::size_t from, std::size_t to) const noexcept {
+            const auto dx = from % width_ > to % width_ ? from % width_ - to % width_ : to % width_ - from % width_;
+            const auto dy = from / width_ > to / width_ ? from / width_ - to / width_ : to / width_ - from / width_;
+            return static_cast<std::uint32_t>(conn_ == connectivity::eight ? std::max(dx, dy) : dx + dy);
+        }
+
+        [[nodiscard]] std::uint32_t heuristic(std::size_t i) const noexcept {
+            return steps(i, goal_);
+        }
+
+        /// Returns the next jump point from `(x, y)` in direction `(dx, dy)`, or `npos`.
+        [[nodiscard]] std::size_t jump(std::ptrdiff_t x, std::ptrdiff_t y, int dx, int dy) const noexcept {
+            const auto goalX = static_cast<std::ptrdiff_t>(goal_ % width_);
+            const auto goalY = static_cast<std::ptrdiff_t>(goal_ / width_);
+            if (dy == 0) {
+                const auto i = rows_.scan(static_cast<std::size_t>(y + 1), static_cast<std::size_t>(x + 1), dx > 0, conn_, y == goalY ? static_cast<std::size_t>(goalX + 1) : npos);
+                return i == npos ? npos : static_cast<std::size_t>(y) * width_ + i - 1;
+            }
+            if (dx == 0 && conn_ == connectivity::eight) {
+                const auto i = cols_.scan(static_cast<std::size_t>(x + 1), static_cast<std::size_t>(y + 1), dy > 0, conn_, x == goalX ? static_cast<std::size_t>(goalY + 1) : npos);
+                return i == npos ? npos : (i - 1) * width_ + static_cast<std::size_t>(x);
+            }
+
+            // diagonal moves, and vertical moves on four-connected grids, may turn onto a row at any cell
+            while (true) {
+                x += dx;
+                y += dy;
+                if (!open(x, y))
+                    return npos;
+                const auto i = static_cast<std::size_t>(y) * width_ + static_cast<std::size_t>(x);
+                if (i == goal_)
+                    return i;
+                if (dx != 0) {
+                    if ((!open(x - dx, y) && open(x - dx, y + dy)) || (!open(x, y - dy) && open(x + dx, y - dy)))
+                        return i;
+                    if (jump(x, y, dx, 0) != npos || jump(x, y, 0, dy) != npos)
+                        return i;
+                } else if (jump(x, y, 1, 0) != npos || jump(x, y, -1, 0) != npos) {
+                    return i;
+                }
+            }
+        }
+
+        /// Calls `emit(n)` for the jump point reached along each direction not pruned by the move that led to cell `i`.
+        template <typename Emit>
+        void successors(std::size_t i, Emit emit) const {
+            const auto x = static_cast<std::ptrdiff_t>(i % width_);
+            const auto y = static_cast<std::ptrdiff_t>(i / width_);
+            const auto visit = [&](int dx, int dy) {
+                if (const auto n = jump(x, y, dx, dy); n != npos)
+                    emit(n);
+            };
+
+            const auto parent = parents_[i];
+            if (parent == i) {
+                visit(1, 0);
+                visit(-1, 0);
+                visit(0, 1);
+                visit(0, -1);
+                if (conn_ == connectivity::eight) {
+                    visit(1, 1);
+                    visit(1, -1);
+                    visit(-1, 1);
+                    visit(-1, -1);
+                }
+                return;
+            }
+
+            const auto px = static_cast<std::ptrdiff_t>(parent % width_);
+            const auto py = static_cast<std::ptrdiff_t>(parent / width_);
+            const int dx = (x > px) - (x < px);
+            const int dy = (y > py) - (y < py);
+            if (conn_ == connectivity::four) {
+                if (dx != 0) {
+                    visit(dx, 0);
+                    for (const int side : {1, -1})
+                        if (open(x, y + side) && !open(x - dx, y + side))
+                            visit(0, side);
+                } else {
+                    visit(0, dy);
+                    visit(1, 0);
+                    visit(-1, 0);
+                }
+            } else if (dx != 0 && dy != 0) {
+                visit(dx, 0);
+                visit(0, dy);
+                visit(dx, dy);
+                if (!open(x - dx, y))
+                    visit(-dx, dy);
+                if (!open(x, y - dy))
+                    visit(dx, -dy);
+            } else if (dx != 0) {
+                visit(dx, 0);
+                for (const int side : {1, -1})
+                    if (!open(x, y + side))
+                        visit(dx, side);
+            } else {
+                visit(0, dy);
+                for (const int side : {1, -1})
+                    if (!open(x + side, y))
+                        visit(side, dy);
+            }
+        }
+    };
+}   // namespace aoc
+
+#endif  // JUMP_POINT_HPP
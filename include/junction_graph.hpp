@@ -0,0 +1,185 @@
+#ifndef JUNCTION_GRAPH_HPP
+#define JUNCTION_GRAPH_HPP
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+#include "area.hpp"
+#include "bitset.hpp"
+#include "dijkstra.hpp"
+#include "grid.hpp"
+#include "pos.hpp"
+
+namespace aoc {
+    /// Represents a directed graph in compressed sparse row form: the edges leaving node `n` are entries `offsets[n]` to `offsets[n + 1]` of `targets` and `weights`.
+    template <typename Weight = std::uint32_t>
+    struct csr_graph {
+        std::vector<std::size_t> offsets{0};
+        std::vector<std::uint32_t> targets;
+        std::vector<Weight> weights;
+
+        [[nodiscard]] constexpr std::size_t nodes() const noexcept {
+            return offsets.size() - 1;
+        }
+
+        [[nodiscard]] constexpr std::size_t edges() const noexcept {
+            return targets.size();
+        }
+
+        /// Calls `func(target, weight)` for every edge leaving `node`, which matches the `emit` callback of `dijkstra`.
+        template <typename Func>
+        constexpr void for_each_edge(std::uint32_t node, Func&& func) const {
+            for (auto e = offsets[node]; e < offsets[node + 1]; ++e)
+                func(targets[e], weights[e]);
+        }
+    };
+
+    /// Represents a grid contracted to its junctions, where each edge stands for a whole corridor and weighs its length in steps.
+    template <std::integral T = std::size_t>
+    struct junction_graph {
+        static constexpr std::uint32_t npos = std::numeric_limits<std::uint32_t>::max();
+
+        std::vector<pos<T>> positions;
+        std::unordered_map<pos<T>, std::uint32_t> ids;
+        csr_graph<std::uint32_t> graph;
+
+        /// Returns the node at `p`, or `npos` if `p` is not a junction.
+        [[nodiscard]] std::uint32_t node(const pos<T>& p) const {
+            const auto it = ids.find(p);
+            return it == ids.end() ? npos : it->second;
+        }
+    };
+
+    /// Contracts the passable cells of an area into a junction graph. Cells whose number of passable neighbours is not two become nodes,
+    /// as does every cell satisfying `keep`, so start and goal cells stay addressable. Parallel corridors between two junctions stay separate edges.
+    /// `passable` is called with the cell's `pos<T>` when it accepts one, otherwise with its row-major index within the area.
+    template <std::integral T, typename Pass, std::predicate<const pos<T>&> Keep>
+    [[nodiscard]] junction_graph<T> contract_corridors(const area<T>& bounds, Pass passable, Keep keep, connectivity conn = connectivity::four) {
+        const auto width = static_cast<std::size_t>(bounds.cols());
+        const auto height = static_cast<std::size_t>(bounds.rows());
+        const auto position = [&](std::size_t i) {
+            return pos<T>{static_cast<T>(bounds.min_x + static_cast<T>(i % width)), static_cast<T>(bounds.min_y + static_cast<T>(i / width))};
+        };
+
+        bitset open{width * height};
+        for (std::size_t i = 0; i < width * height; ++i) {
+            bool value = false;
+            if constexpr (std::predicate<Pass&, pos<T>>)
+                value = passable(position(i));
+            else
+                value = passable(i);
+            if (value)
+                open.set(i);
+        }
+
+        junction_graph<T> result;
+        std::vector<std::uint32_t> ids(width * height, result.npos);
+        for (std::size_t i = 0; i < width * height; ++i) {
+            if (!open.test(i))
+                continue;
+            std::size_t degree = 0;
+            detail::any_neighbour(i, width, height, conn, [&](std::size_t n) { return (degree += open.test(n)) > 2; });
+            if (degree != 2 || keep(position(i))) {
+                ids[i] = static_cast<std::uint32_t>(result.positions.size());
+                result.positions.push_back(position(i));
+                result.ids.emplace(position(i), ids[i]);
+            }
+        }
+
+        // walks every corridor leaving each node until it reaches another node; interior cells have exactly one way onwards
+        auto& graph = result.graph;
+        for (std::size_t node = 0; node < result.positions.size(); ++node) {
+            const auto from = static_cast<std::size_t>(result.positions[node].y - bounds.min_y) * width + static_cast<std::size_t>(result.positions[node].x - bounds.min_x);
+            detail::any_neighbour(from, width, height, conn, [&](std::size_t first) {
+                if (!open.test(first))
+                    return false;
+                auto previous = from;
+                auto current = first;
+                std::uint32_t length = 1;
+                while (ids[current] == result.npos) {
+                    detail::any_neighbour(current, width, height, conn, [&](std::size_t n) {
+                        if (n == previous || !open.test(n))
+                            return false;
+                        previous = current;
+                        current = n;
+                        return true;
+                    });
+                    ++length;
+                }
+                if (current != from) {
+                    graph.targets.push_back(ids[current]);
+                    graph.weights.push_back(length);
+                }
+                return false;
+            });
+            graph.offsets.push_back(graph.targets.size());
+        }
+        return result;
+    }
+
+    template <std::integral T, typename Pass>
+    [[nodiscard]] junction_graph<T> contract_corridors(const area<T>& bounds, Pass passable, connectivity conn = connectivity::four) {
+        return contract_corridors(bounds, passable, [](const pos<T>&) { return false; }, conn);
+    }
+
+    /// Returns the shortest distance between every pair of nodes, where row `s` holds the distances from node `s`.
+    /// Unreachable pairs hold the largest `Weight`.
+    template <std::unsigned_integral Weight>
+    [[nodiscard]] grid<Weight> all_pairs_distances(const csr_graph<Weight>& graph) {
+        constexpr auto unreachable = std::numeric_limits<Weight>::max();
+        const auto n = graph.nodes();
+        grid<Weight> result{n, n, unreachable};
+        dary_heap<std::uint32_t, Weight> queue;
+        for (std::size_t source = 0; source < n; ++source) {
+            result.at(source, source) = 0;
+            queue.push(0, static_cast<std::uint32_t>(source));
+            while (!queue.empty()) {
+                const auto [cost, node] = queue.pop();
+                if (cost > result.at(node, source))
+                    continue;
+                graph.for_each_edge(node, [&](std::uint32_t next, Weight weight) {
+                    const auto total = static_cast<Weight>(cost + weight);
+                    if (total < result.at(next, source)) {
+                        result.at(next, source) = total;
+                        queue.push(total, next);
+                    }
+                });
+            }
+        }
+        return result;
+    }
+
+    namespace detail {
+        template <typename Weight>
+        void longest_path(const csr_graph<Weight>& graph, std::uint32_t node, std::uint32_t to, Weight length, bitset& visited, Weight& best) {
+            if (node == to) {
+                best = best == std::numeric_limits<Weight>::max() ? length : std::max(best, length);
+                return;
+            }
+            visited.set(node);
+            graph.for_each_edge(node, [&](std::uint32_t next, Weight weight) {
+                if (!visited.test(next))
+                    longest_path(graph, next, to, static_cast<Weight>(length + weight), visited, best);
+            });
+            visited.reset(node);
+        }
+    }   // namespace detail
+
+    /// Returns the length of the longest simple path from `from` to `to` by exhaustive search, or the largest `Weight` if there is none.
+    /// Only practical on small graphs, which is what contracting a maze usually produces.
+    template <std::unsigned_integral Weight>
+    [[nodiscard]] Weight longest_path(const csr_graph<Weight>& graph, std::uint32_t from, std::uint32_t to) {
+        if (from >= graph.nodes() || to >= graph.nodes())
+            throw std::out_of_range{"node"};
+        auto best = std::numeric_limits<Weight>::max();
+        bitset visited{graph.nodes()};
+        detail::longest_path(graph, from, to, Weight{}, visited, best);
+        return best;
+    }
+}   // namespace aoc
+
+#endif  // JUNCTION_GRAPH_HPP
@@ -0,0 +1,411 @@
+#ifndef LIFE_HPP
+#define LIFE_HPP
+#include <algorithm>
+#include <barrier>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "grid.hpp"
+#include "parallel.hpp"
+#include "pos.hpp"
+
+namespace aoc {
+    /// What lies beyond the edge of a cellular automaton: dead cells, dead cells with the outermost ring frozen, or the opposite edge.
+    enum class border { dead, fixed, wrap };
+
+    /// Represents a life-like rule as the neighbour counts that give birth to a dead cell and keep a live cell alive.
+    class life_rule {
+    public:
+        /// Parses rule strings such as `B3/S23` or `S23/B36`, in either case.
+        constexpr explicit life_rule(std::string_view rule = "B3/S23") {
+            bool seenBirth = false;
+            bool seenSurvival = false;
+            std::uint16_t* target = nullptr;
+            for (const auto c : rule) {
+                if (c == 'B' || c == 'b') {
+                    if (seenBirth)
+                        throw std::invalid_argument{"rule"};
+                    seenBirth = true;
+                    target = &birth_;
+                } else if (c == 'S' || c == 's') {
+                    if (seenSurvival)
+                        throw std::invalid_argument{"rule"};
+                    seenSurvival = true;
+                    target = &survival_;
+                } else if (c >= '0' && c <= '8' && target != nullptr) {
+                    *target |= static_cast<std::uint16_t>(1U << (c - '0'));
+                } else if (c != '/' || target == nullptr) {
+                    throw std::invalid_argument{"rule"};
+                }
+            }
+            if (!seenBirth || !seenSurvival)
+                throw std::invalid_argument{"rule"};
+        }
+
+        /// Bit `n` is set when a dead cell with `n` live neighbours is born.
+        [[nodiscard]] constexpr std::uint16_t birth() const noexcept {
+            return birth_;
+        }
+
+        /// Bit `n` is set when a live cell with `n` live neighbours survives.
+        [[nodiscard]] constexpr std::uint16_t survival() const noexcept {
+            return survival_;
+        }
+
+        [[nodiscard]] constexpr bool next(bool alive, unsigned neighbours) const noexcept {
+            return ((alive ? survival_ : birth_) >> neighbours) & 1;
+        }
+
+    private:
+        std::uint16_t birth_ = 0;
+        std::uint16_t survival_ = 0;
+    };
+
+    /// Life-like cellular automaton over a bit-packed grid, one bit per cell and 64 cells per word.
+    /// Neighbour counts for a whole word are summed at once by bit-sliced adders, and the two generations are double-buffered.
+    /// Stepping may split the rows into bands, one per thread, each reading the rows just outside its band from the shared front buffer.
+    /// The threads are kept between calls, so stepping one generation at a time does not start them anew; copies start without any.
+    class life {
+    public:
+        using word_type = std::uint64_t;
+        static constexpr std::size_t word_bits = 64;
+
+        explicit life(std::size_t width, std::size_t height, life_rule rule = life_rule{}, border edge = border::dead)
+            : width_{width}, height_{height}, stride_{(width + word_bits - 1) / word_bits}, rule_{rule}, border_{edge},
+              cells_(stride_ * height), next_(stride_ * height), blank_(stride_) {}
+
+        life(const life& other)
+            : width_{other.width_}, height_{other.height_}, stride_{other.stride_}, rule_{other.rule_}, border_{other.border_},
+              cells_{other.cells_}, next_{other.next_}, blank_{other.blank_} {}
+
+        life(life&&) noexcept = default;
+
+        life& operator=(const life& other) {
+            if (this != &other)
+                *this = life{other};
+            return *this;
+        }
+
+        life& operator=(life&&) noexcept = default;
+        ~life() = default;
+
+        /// Creates an automaton from a grid, where the cells satisfying `alive` start alive.
+        template <typename Grid, typename Alive>
+        [[nodiscard]] static life from_grid(const Grid& g, Alive alive, life_rule rule = life_rule{}, border edge = border::dead) {
+            life result{g.width(), g.height(), rule, edge};
+            for (std::size_t y = 0; y < g.height(); ++y)
+                for (std::size_t x = 0; x < g.width(); ++x)
+                    result.set(x, y, alive(g.at(x, y)));
+            return result;
+        }
+
+        [[nodiscard]] constexpr std::size_t width() const noexcept {
+            return width_;
+        }
+
+        [[nodiscard]] constexpr std::size_t height() const noexcept {
+            return height_;
+        }
+
+        [[nodiscard]] constexpr const life_rule& rule() const noexcept {
+            return rule_;
+        }
+
+        [[nodiscard]] bool test(std::size_t x, std::size_t y) const noexcept {
+            return cells_[y * stride_ + x / word_bits] >> (x % word_bits) & 1;
+        }
+
+        template <std::integral U>
+        [[nodiscard]] bool test(const pos<U>& p) const noexcept {
+            return test(static_cast<std::size_t>(p.x), static_cast<std::size_t>(p.y));
+        }
+
+        void set(std::size_t x, std::size_t y, bool alive = true) noexcept {
+            auto& word = cells_[y * stride_ + x / word_bits];
+            const auto mask = word_type{1} << (x % word_bits);
+            word = alive ? word | mask : word & ~mask;
+        }
+
+        template <std::integral U>
+        void set(const pos<U>& p, bool alive = true) noexcept {
+            set(static_cast<std::size_t>(p.x), static_cast<std::size_t>(p.y), alive);
+        }
+
+        /// Returns the number of live cells.
+        [[nodiscard]] std::size_t population() const noexcept {
+            std::size_t result = 0;
+            for (const auto word : cells_)
+                result += static_cast<std::size_t>(std::popcount(word));
+            return result;
+        }
+
+        /// Advances the automaton by up to `generations` steps over `threads` threads (0 for all cores), and returns whether the last step changed any cell.
+        /// Stops early once a step changes nothing, since every later step would be the same.
+        bool step(std::size_t generations = 1, std::size_t threads = 1) {
+            if (cells_.empty() || generations == 0)
+                return false;
+            threads = std::min(thread_count(threads), height_);
+            if (threads == 1) {
+                bool changed = true;
+                for (std::size_t g = 0; g < generations && changed; ++g) {
+                    changed = step_rows(0, height_);
+                    cells_.swap(next_);
+                }
+                return changed;
+            }
+
+            if (!workers_ || workers_->threads.size() + 1 != threads)
+                workers_ = std::make_unique<band_workers>(threads);
+            return workers_->run(*this, generations);
+        }
+
+    private:
+        std::size_t width_;
+        std::size_t height_;
+        std::size_t stride_;
+        life_rule rule_;
+        border border_;
+        std::vector<word_type> cells_;
+        std::vector<word_type> next_;
+        std::vector<word_type> blank_;
+
+        /// Threads that outlive a call to `step`, each stepping one band of rows per generation and meeting at a barrier
+        /// whose completion swaps the buffers. Whether to go on is only decided in the completions, so a worker still reading
+        /// the last answer never races with the next call.
+        struct band_workers {
+            struct starter {
+                band_workers* self;
+
+                void operator()() const noexcept {
+                    self->done = 0;
+                    self->more = true;
+                }
+            };
+
+            struct finisher {
+                band_workers* self;
+
+                void operator()() const noexcept {
+                    self->changed = std::ranges::find(self->band_changed, std::uint8_t{1}) != self->band_changed.end();
+                    self->owner->cells_.swap(self->owner->next_);
+                    self->more = self->changed && ++self->done < self->generations;
+                }
+            };
+
+            life* owner = nullptr;
+            std::size_t generations = 0;
+            std::size_t done = 0;
+            bool more = false;
+            bool changed = false;
+            bool stop = false;
+            std::vector<std::uint8_t> band_changed;
+            std::barrier<starter> start;
+            std::barrier<finisher> sync;
+            std::vector<std::jthread> threads;
+
+            explicit band_workers(std::size_t count)
+                : band_changed(count), start{static_cast<std::ptrdiff_t>(count), starter{this}}, sync{static_cast<std::ptrdiff_t>(count), finisher{this}} {
+                threads.reserve(count - 1);
+                try {
+                    for (std::size_t t = 1; t < count; ++t)
+                        threads.emplace_back([this, t] {
+                            while (true) {
+                                start.arrive_and_wait();
+                                if (stop)
+                                    return;
+                                work(t);
+                            }
+                        });
+                } catch (...) {
+                    // arrives for this thread and the workers that never started, so those that did see `stop` and can be joined
+                    stop = true;
+                    start.wait(start.arrive(static_cast<std::ptrdiff_t>(count - threads.size())));
+                    threads.clear();
+                    throw;
+                }
+            }
+
+            band_workers(const band_workers&) = delete;
+            band_workers& operator=(const band_workers&) = delete;
+
+            ~band_workers() {
+                stop = true;
+                start.arrive_and_wait();
+            }
+
+            bool run(life& target, std::size_t count) {
+                owner = &target;
+                generations = count;
+                start.arrive_and_wait();
+                work(0);
+                return changed;
+            }
+
+            void work(std::size_t t) {
+                const auto bands = band_changed.size();
+                const auto begin = owner->height_ * t / bands;
+                const auto end = owner->height_ * (t + 1) / bands;
+                do {
+                    band_changed[t] = owner->step_rows(begin, end);
+                    sync.arrive_and_wait();
+                } while (more);
+            }
+        };
+
+        std::unique_ptr<band_workers> workers_;
+
+        [[nodiscard]] const word_type* row(std::size_t y) const noexcept {
+            return cells_.data() + y * stride_;
+        }
+
+        /// Returns the row above or below `y`, which past the edge is either the opposite row or a blank one.
+        [[nodiscard]] const word_type* neighbour_row(std::size_t y, bool up) const noexcept {
+            if (up ? y + 1 < height_ : y > 0)
+                return row(up ? y + 1 : y - 1);
+            if (border_ == border::wrap)
+                return row(up ? 0 : height_ - 1);
+            return blank_.data();
+        }
+
+        /// Returns word `k` of a row moved one cell, so each bit holds its west (`fromWest`) or east neighbour.
+        /// Bits past the width are always clear, so they shift in as dead cells.
+        [[nodiscard]] word_type shifted(const word_type* r, std::size_t k, bool fromWest) const noexcept {
+            const auto last = (width_ - 1) % word_bits;
+            if (fromWest) {
+                word_type carry = 0;
+                if (k > 0)
+                    carry = r[k - 1] >> (word_bits - 1);
+                else if (border_ == border::wrap)
+                    carry = r[stride_ - 1] >> last & 1;
+                return r[k] << 1 | carry;
+            }
+            word_type carry = 0;
+            if (k + 1 < stride_)
+                carry = r[k + 1] << (word_bits - 1);
+            else if (border_ == border::wrap)
+                carry = (r[0] & 1) << last;
+            return r[k] >> 1 | carry;
+        }
+
+        /// Computes the next generation of rows `[begin, end)` into the back buffer, and returns whether any of them changed.
+        bool step_rows(std::size_t begin, std::size_t end) noexcept {
+            word_type changed = 0;
+            for (std::size_t y = begin; y < end; ++y) {
+                const auto* up = neighbour_row(y, true);
+                const auto* mid = row(y);
+                const auto* down = neighbour_row(y, false);
+                auto* out = next_.data() + y * stride_;
+                for (std::size_t k = 0; k < stride_; ++k) {
+                    const word_type n[8] = {
+                        shifted(up, k, true), up[k], shifted(up, k, false),
+                        shifted(mid, k, true), shifted(mid, k, false),
+                        shifted(down, k, true), down[k], shifted(down, k, false),
+                    };
+
+                    // sums eight one-bit neighbours into a four-bit count per cell with full and half adders
+                    const auto fullAdd = [](word_type a, word_type b, word_type c) {
+                        return std::pair{a ^ b ^ c, (a & b) | (c & (a ^ b))};
+                    };
+                    const auto [ones0, twos0] = fullAdd(n[0], n[1], n[2]);
+                    const auto [ones1, twos1] = fullAdd(n[3], n[4], n[5]);
+                    const auto ones2 = n[6] ^ n[7];
+                    const auto twos2 = n[6] & n[7];
+                    const auto [s0, twos3] = fullAdd(ones0, ones1, ones2);
+                    const auto [t, fours0] = fullAdd(twos0, twos1, twos2);
+                    const auto s1 = t ^ twos3;
+                    const auto fours1 = t & twos3;
+                    const auto s2 = fours0 ^ fours1;
+                    const auto s3 = fours0 & fours1;
+
+                    const auto alive = mid[k];
+                    word_type result = 0;
+                    for (unsigned count = 0; count <= 8; ++count) {
+                        const bool birth = rule_.next(false, count);
+                        const bool survival = rule_.next(true, count);
+                        if (!birth && !survival)
+                            continue;
+                        const auto equal = (count & 1 ? s0 : ~s0) & (count & 2 ? s1 : ~s1) & (count & 4 ? s2 : ~s2) & (count & 8 ? s3 : ~s3);
+                        result |= equal & ((birth ? ~alive : 0) | (survival ? alive : 0));
+                    }
+                    out[k] = result;
+                }
+                if (width_ % word_bits != 0)
+                    out[stride_ - 1] &= (word_type{1} << (width_ % word_bits)) - 1;
+
+                if (border_ == border::fixed) {
+                    if (y == 0 || y + 1 == height_) {
+                        std::copy(mid, mid + stride_, out);
+                    } else {
+                        const auto keep = [&](std::size_t x) {
+                            const auto mask = word_type{1} << (x % word_bits);
+                            out[x / word_bits] = (out[x / word_bits] & ~mask) | (mid[x / word_bits] & mask);
+                        };
+                        keep(0);
+                        keep(width_ - 1);
+                    }
+                }
+                for (std::size_t k = 0; k < stride_; ++k)
+                    changed |= out[k] ^ mid[k];
+            }
+            return changed != 0;
+        }
+    };
+
+    /// Advances a grid of 0 and 1 bytes by one generation into `next`, which must have the same size, and returns whether any cell changed.
+    /// Each row's vertical sums are built first and then added across, so both passes are plain loops over bytes the compiler can vectorise.
+    template <typename Layout>
+    bool life_step(const grid<std::uint8_t, Layout>& current, grid<std::uint8_t, Layout>& next, const life_rule& rule, border edge = border::dead) {
+        if (current.width() != next.width() || current.height() != next.height())
+            throw std::invalid_argument{"next"};
+        const auto width = current.width();
+        const auto height = current.height();
+        if (width == 0 || height == 0)
+            return false;
+
+        std::vector<std::uint8_t> above(width);
+        std::vector<std::uint8_t> below(width);
+        std::vector<std::uint8_t> middle(width);
+        std::vector<std::uint8_t> sums(width + 2);
+        const auto load = [&](std::vector<std::uint8_t>& out, std::size_t y, bool valid) {
+            for (std::size_t x = 0; x < width; ++x)
+                out[x] = valid ? current.at(x, y) : 0;
+        };
+
+        bool changed = false;
+        for (std::size_t y = 0; y < height; ++y) {
+            const bool wrap = edge == border::wrap;
+            load(above, y > 0 ? y - 1 : height - 1, y > 0 || wrap);
+            load(middle, y, true);
+            load(below, y + 1 < height ? y + 1 : 0, y + 1 < height || wrap);
+            for (std::size_t x = 0; x < width; ++x)
+                sums[x + 1] = static_cast<std::uint8_t>(above[x] + middle[x] + below[x]);
+            sums[0] = wrap ? sums[width] : 0;
+            sums[width + 1] = wrap ? sums[1] : 0;
+            for (std::size_t x = 0; x < width; ++x) {
+                const auto count = static_cast<unsigned>(sums[x] + sums[x + 1] + sums[x + 2] - middle[x]);
+                next.at(x, y) = static_cast<std::uint8_t>(((middle[x] ? rule.survival() : rule.birth()) >> count) & 1);
+            }
+            if (edge == border::fixed) {
+                if (y == 0 || y + 1 == height) {
+                    for (std::size_t x = 0; x < width; ++x)
+                        next.at(x, y) = middle[x];
+                } else {
+                    next.at(0, y) = middle[0];
+                    next.at(width - 1, y) = middle[width - 1];
+                }
+            }
+            for (std::size_t x = 0; x < width; ++x)
+                changed |= next.at(x, y) != middle[x];
+        }
+        return changed;
+    }
+}   // namespace aoc
+
+#endif  // LIFE_HPP
@@ -0,0 +1,32 @@
+#ifndef PARALLEL_HPP
+#define PARALLEL_HPP
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace aoc {
+    /// Returns `threads`, or the hardware concurrency when it is 0.
+    [[nodiscard]] inline std::size_t thread_count(std::size_t threads = 0) noexcept {
+        return threads != 0 ? threads : std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    }
+
+    /// Splits `[0, count)` into contiguous bands and calls `func(begin, end)` for each band on its own thread.
+    template <std::invocable<std::size_t, std::size_t> Func>
+    void parallel_bands(std::size_t count, std::size_t threads, Func func) {
+        threads = std::min(thread_count(threads), std::max<std::size_t>(count, 1));
+        if (threads == 1) {
+            func(0, count);
+            return;
+        }
+
+        std::vector<std::jthread> workers;
+        workers.reserve(threads - 1);
+        for (std::size_t t = 1; t < threads; ++t)
+            workers.emplace_back([&func, begin = count * t / threads, end = count * (t + 1) / threads] { func(begin, end); });
+        func(0, count / threads);
+    }
+}   // namespace aoc
+
+#endif  // PARALLEL_HPP
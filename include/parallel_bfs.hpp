@@ -0,0 +1,238 @@
+#ifndef PARALLEL_BFS_HPP
+#define PARALLEL_BFS_HPP
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <barrier>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <ranges>
+#include <thread>
+#include <vector>
+#include "area.hpp"
+#include "bitset.hpp"
+#include "grid.hpp"
+#include "parallel.hpp"
+#include "pos.hpp"
+
+namespace aoc {
+    /// Level-synchronous breadth-first search over the cells of an area, expanding each level on several threads.
+    /// Switches to bottom-up expansion (unvisited cells look for a parent) while the frontier is a large share of the unvisited cells.
+    /// `passable` is called concurrently with the cell's `pos<T>` when it accepts one, otherwise with its row-major index.
+    /// If it throws, the search stops after the current level and `run` rethrows the first exception.
+    template <std::integral T = std::size_t>
+    class parallel_bfs {
+    public:
+        static constexpr std::uint32_t unreachable = std::numeric_limits<std::uint32_t>::max();
+
+        constexpr explicit parallel_bfs(const area<T>& bounds, std::size_t threads = 0, connectivity conn = connectivity::four)
+            : bounds_{bounds}, width_{static_cast<std::size_t>(bounds.cols())}, height_{static_cast<std::size_t>(bounds.rows())}, threads_{thread_count(threads)},
+              conn_{conn}, visited_{width_ * height_}, frontier_bits_{width_ * height_}, distances_(width_ * height_), locals_(threads_), offsets_(threads_ + 1) {}
+
+        [[nodiscard]] constexpr const area<T>& bounds() const noexcept {
+            return bounds_;
+        }
+
+        [[nodiscard]] constexpr std::size_t index(const pos<T>& p) const noexcept {
+            return static_cast<std::size_t>(p.y - bounds_.min_y) * width_ + static_cast<std::size_t>(p.x - bounds_.min_x);
+        }
+
+        /// Number of levels expanded bottom-up by the last run.
+        [[nodiscard]] constexpr std::size_t bottom_up_levels() const noexcept {
+            return bottom_up_levels_;
+        }
+
+        /// Explores everything reachable from `starts` and returns the number of cells reached.
+        template <std::ranges::input_range Rng, typename Pass>
+        std::size_t run(const Rng& starts, Pass passable) {
+            visited_.clear();
+            frontier_.clear();
+            for (auto& local : locals_)
+                local.clear();
+            failed_.clear();
+            error_ = nullptr;
+            level_ = 0;
+            bottom_up_ = false;
+            bottom_up_levels_ = 0;
+            for (const pos<T>& start : starts) {
+                if (bounds_.has(start) && !visited_.test_and_set(index(start))) {
+                    distances_[index(start)] = 0;
+                    frontier_.push_back(index(start));
+                }
+            }
+            reached_ = frontier_.size();
+            unexplored_ = width_ * height_ - reached_;
+            if (frontier_.empty())
+                return 0;
+
+            // each level expands into per-thread lists, then the threads copy their lists into the resized frontier side by side
+            std::barrier sync{static_cast<std::ptrdiff_t>(threads_), [this]() noexcept { finish_level(); }};
+            std::barrier merge{static_cast<std::ptrdiff_t>(threads_)};
+            const auto work = [&](std::size_t t) {
+                while (true) {
+                    guard([&] {
+                        if (bottom_up_)
+                            expand_bottom_up(t, passable);
+                        else
+                            expand_top_down(t, passable);
+                    });
+                    sync.arrive_and_wait();
+                    if (done_)
+                        return;
+                    if (t == 0)
+                        guard([this] { frontier_.resize(offsets_.back()); });
+                    merge.arrive_and_wait();
+                    if (error_)
+                        return;
+                    merge_local(t);
+                    merge.arrive_and_wait();
+                }
+            };
+
+            std::vector<std::jthread> workers;
+            workers.reserve(threads_ - 1);
+            for (std::size_t t = 1; t < threads_; ++t)
+                workers.emplace_back(work, t);
+            work(0);
+            workers.clear();
+            if (error_)
+                std::rethrow_exception(error_);
+            return reached_;
+        }
+
+        template <typename Pass>
+        std::size_t run(const pos<T>& start, Pass passable) {
+            return run(std::array{start}, passable);
+        }
+
+        [[nodiscard]] constexpr bool reached(const pos<T>& p) const noexcept {
+            return bounds_.has(p) && visited_.test(index(p));
+        }
+
+        /// Returns the distance to `p` found by the last run, or `unreachable`.
+        [[nodiscard]] constexpr std::uint32_t distance(const pos<T>& p) const noexcept {
+            return reached(p) ? distances_[index(p)] : unreachable;
+        }
+
+    private:
+        static constexpr std::size_t chunk = 1024;
+        static constexpr std::size_t alpha = 14;
+        static constexpr std::size_t beta = 24;
+
+        area<T> bounds_;
+        std::size_t width_;
+        std::size_t height_;
+        std::size_t threads_;
+        connectivity conn_;
+        bitset visited_;
+        bitset frontier_bits_;
+        std::vector<std::uint32_t> distances_;
+        std::vector<std::size_t> frontier_;
+        std::vector<std::vector<std::size_t>> locals_;
+        std::vector<std::size_t> offsets_;
+        std::atomic<std::size_t> cursor_ = 0;
+        std::uint32_t level_ = 0;
+        bool bottom_up_ = false;
+        std::size_t bottom_up_levels_ = 0;
+        std::size_t reached_ = 0;
+        std::size_t unexplored_ = 0;
+        bool done_ = false;
+        std::atomic_flag failed_;
+        std::exception_ptr error_;
+
+        /// Calls `func`, keeping the first exception thrown on any thread for `run` to rethrow.
+        template <typename Func>
+        void guard(Func func) noexcept {
+            try {
+                func();
+            } catch (...) {
+                if (!failed_.test_and_set())
+                    error_ = std::current_exception();
+            }
+        }
+
+        template <typename Pass>
+        [[nodiscard]] bool is_passable(Pass& passable, std::size_t i) const {
+            if constexpr (std::predicate<Pass&, pos<T>>)
+                return passable(pos<T>{static_cast<T>(bounds_.min_x + static_cast<T>(i % width_)), static_cast<T>(bounds_.min_y + static_cast<T>(i / width_))});
+            else
+                return passable(i);
+        }
+
+        template <typename Func>
+        bool any_neighbour(std::size_t i, Func func) const {
+            return detail::any_neighbour(i, width_, height_, conn_, func);
+        }
+
+        template <typename Pass>
+        void expand_top_down(std::size_t t, Pass& passable) {
+            auto& local = locals_[t];
+            const auto next = level_ + 1;
+            for (auto begin = cursor_.fetch_add(chunk); begin < frontier_.size(); begin = cursor_.fetch_add(chunk)) {
+                for (auto f = begin; f < std::min(begin + chunk, frontier_.size()); ++f) {
+                    any_neighbour(frontier_[f], [&](std::size_t n) {
+                        if (!visited_.atomic_test(n) && is_passable(passable, n) && !visited_.atomic_test_and_set(n)) {
+                            distances_[n] = next;
+                            local.push_back(n);
+                        }
+                        return false;
+                    });
+                }
+            }
+        }
+
+        template <typename Pass>
+        void expand_bottom_up(std::size_t t, Pass& passable) {
+            auto& local = locals_[t];
+            const auto next = level_ + 1;
+            const auto cells = width_ * height_;
+            for (auto begin = cursor_.fetch_add(chunk * 16); begin < cells; begin = cursor_.fetch_add(chunk * 16)) {
+                for (auto i = begin; i < std::min(begin + chunk * 16, cells); ++i) {
+                    if (visited_.atomic_test(i) || !is_passable(passable, i))
+                        continue;
+                    if (any_neighbour(i, [this](std::size_t n) { return frontier_bits_.test(n); })) {
+                        visited_.atomic_test_and_set(i);
+                        distances_[i] = next;
+                        local.push_back(i);
+                    }
+                }
+            }
+        }
+
+        /// Runs on one thread between levels: sizes up the next frontier and picks the direction for it, without allocating.
+        void finish_level() noexcept {
+            bottom_up_levels_ += bottom_up_;
+            for (std::size_t t = 0; t < threads_; ++t)
+                offsets_[t + 1] = offsets_[t] + locals_[t].size();
+            const auto size = offsets_.back();
+            ++level_;
+            reached_ += size;
+            unexplored_ -= size;
+            cursor_ = 0;
+            done_ = size == 0 || failed_.test();
+
+            const auto cells = width_ * height_;
+            if (!bottom_up_ && size > unexplored_ / alpha)
+                bottom_up_ = true;
+            else if (bottom_up_ && size < cells / beta)
+                bottom_up_ = false;
+            if (bottom_up_)
+                frontier_bits_.clear();
+        }
+
+        /// Copies thread `t`'s cells into its slice of the next frontier, marking them in the frontier bits for a bottom-up level.
+        void merge_local(std::size_t t) noexcept {
+            auto& local = locals_[t];
+            std::ranges::copy(local, frontier_.begin() + static_cast<std::ptrdiff_t>(offsets_[t]));
+            if (bottom_up_)
+                for (const auto i : local)
+                    frontier_bits_.atomic_test_and_set(i);
+            local.clear();
+        }
+    };
+}   // namespace aoc
+
+#endif  // PARALLEL_BFS_HPP
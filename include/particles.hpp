@@ -0,0 +1,155 @@
+#ifndef PARTICLES_HPP
+#define PARTICLES_HPP
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "area.hpp"
+#include "pos.hpp"
+#include "torus.hpp"
+
+namespace aoc {
+    /// Represents particles moving at constant velocities in an area whose opposite edges are joined.
+    /// Coordinates and velocities are stored as separate arrays of offsets reduced into the area, so stepping is a branchless add and subtract
+    /// per coordinate and jumping to any time costs one modular multiply per coordinate.
+    template <std::signed_integral T = int>
+    class particles {
+    public:
+        explicit particles(const area<T>& space) : space_{space}, mod_x_{detail::checked_length(space.cols())}, mod_y_{detail::checked_length(space.rows())} {}
+
+        [[nodiscard]] constexpr const area<T>& space() const noexcept {
+            return space_;
+        }
+
+        [[nodiscard]] constexpr std::size_t size() const noexcept {
+            return x_.size();
+        }
+
+        [[nodiscard]] constexpr bool empty() const noexcept {
+            return x_.empty();
+        }
+
+        /// Returns the time elapsed since the particles were added, as the sum of every step taken.
+        [[nodiscard]] constexpr long long time() const noexcept {
+            return time_;
+        }
+
+        void reserve(std::size_t n) {
+            x_.reserve(n);
+            y_.reserve(n);
+            vx_.reserve(n);
+            vy_.reserve(n);
+        }
+
+        /// Adds a particle at `p` moving by `v` per step, wrapping the position into the area.
+        void add(const pos<T>& p, const pos<T>& v) {
+            x_.push_back(static_cast<std::uint32_t>(mod_x_(static_cast<long long>(p.x) - space_.min_x)));
+            y_.push_back(static_cast<std::uint32_t>(mod_y_(static_cast<long long>(p.y) - space_.min_y)));
+            vx_.push_back(static_cast<std::uint32_t>(mod_x_(static_cast<long long>(v.x))));
+            vy_.push_back(static_cast<std::uint32_t>(mod_y_(static_cast<long long>(v.y))));
+        }
+
+        [[nodiscard]] pos<T> position(std::size_t i) const noexcept {
+            return pos<T>{static_cast<T>(space_.min_x + static_cast<T>(x_[i])), static_cast<T>(space_.min_y + static_cast<T>(y_[i]))};
+        }
+
+        /// Returns the velocity of a particle reduced into `[0, cols) x [0, rows)`, which moves it the same way as the one it was added with
+        /// but is not that velocity: `{3, -3}` in a 7-row space reads back as `{3, 4}`. Only the reduced form is stored.
+        [[nodiscard]] pos<T> reduced_velocity(std::size_t i) const noexcept {
+            return pos<T>{static_cast<T>(vx_[i]), static_cast<T>(vy_[i])};
+        }
+
+        /// Moves every particle `steps` steps forwards, or backwards when negative.
+        void step(long long steps = 1) {
+            advance(x_, vx_, mod_x_, steps);
+            advance(y_, vy_, mod_y_, steps);
+            time_ += steps;
+        }
+
+        /// Returns the smallest area holding every particle, which is the minimum corner of the space when there are none.
+        [[nodiscard]] area<T> bounds() const {
+            if (empty())
+                return area<T>{space_.min_x, space_.min_y, space_.min_x, space_.min_y};
+            const auto [minX, maxX] = std::ranges::minmax(x_);
+            const auto [minY, maxY] = std::ranges::minmax(y_);
+            return area<T>{static_cast<T>(space_.min_x + static_cast<T>(maxX)), static_cast<T>(space_.min_y + static_cast<T>(maxY)),
+                static_cast<T>(space_.min_x + static_cast<T>(minX)), static_cast<T>(space_.min_y + static_cast<T>(minY))};
+        }
+
+        /// Counts the particles in each quadrant of the space, ordered (min x, min y), (max x, min y), (min x, max y), (max x, max y).
+        /// Particles on the middle column or row of an odd-sized space belong to no quadrant.
+        [[nodiscard]] std::array<std::size_t, 4> quadrants() const noexcept {
+            const auto lowX = mod_x_.divisor() / 2;
+            const auto highX = (mod_x_.divisor() + 1) / 2;
+            const auto lowY = mod_y_.divisor() / 2;
+            const auto highY = (mod_y_.divisor() + 1) / 2;
+            std::array<std::size_t, 4> result{};
+            for (std::size_t i = 0; i < size(); ++i) {
+                const bool left = x_[i] < lowX;
+                const bool right = x_[i] >= highX;
+                const bool top = y_[i] < lowY;
+                const bool bottom = y_[i] >= highY;
+                result[0] += left && top;
+                result[1] += right && top;
+                result[2] += left && bottom;
+                result[3] += right && bottom;
+            }
+            return result;
+        }
+
+        /// Returns the variance of the x and y coordinates, which drops sharply when the particles gather into a picture.
+        /// Since each axis repeats every `cols` or `rows` steps, the times minimising each can be combined with the Chinese remainder theorem.
+        [[nodiscard]] pos<double> variance() const noexcept {
+            return pos<double>{axis_variance(x_), axis_variance(y_)};
+        }
+
+    private:
+        area<T> space_;
+        fast_mod mod_x_;
+        fast_mod mod_y_;
+        long long time_ = 0;
+        std::vector<std::uint32_t> x_;
+        std::vector<std::uint32_t> y_;
+        std::vector<std::uint32_t> vx_;
+        std::vector<std::uint32_t> vy_;
+
+        /// Adds `velocity * steps` to every coordinate modulo the axis length, where velocities and coordinates are already reduced.
+        static void advance(std::vector<std::uint32_t>& coords, const std::vector<std::uint32_t>& velocity, const fast_mod& mod, long long steps) {
+            const std::uint64_t length = mod.divisor();
+            const auto times = static_cast<std::uint64_t>(mod(steps));
+            const auto wrap = [length](std::uint32_t c, std::uint64_t delta) {
+                const auto sum = c + delta;
+                return static_cast<std::uint32_t>(sum - (length & -static_cast<std::uint64_t>(sum >= length)));
+            };
+
+            if (times == 1) {
+                for (std::size_t i = 0; i < coords.size(); ++i)
+                    coords[i] = wrap(coords[i], velocity[i]);
+            } else if (length <= 0x10000) {
+                // both factors are below 2^16, so the product fits the 32-bit reduction
+                for (std::size_t i = 0; i < coords.size(); ++i)
+                    coords[i] = wrap(coords[i], mod.reduce(static_cast<std::uint32_t>(velocity[i] * times)));
+            } else if (times != 0) {
+                for (std::size_t i = 0; i < coords.size(); ++i)
+                    coords[i] = wrap(coords[i], velocity[i] * times % length);
+            }
+        }
+
+        [[nodiscard]] static double axis_variance(const std::vector<std::uint32_t>& coords) noexcept {
+            if (coords.empty())
+                return 0;
+            double sum = 0;
+            for (const auto c : coords)
+                sum += c;
+            const auto mean = sum / static_cast<double>(coords.size());
+            double squares = 0;
+            for (const auto c : coords)
+                squares += (c - mean) * (c - mean);
+            return squares / static_cast<double>(coords.size());
+        }
+    };
+}   // namespace aoc
+
+#endif  // PARTICLES_HPP
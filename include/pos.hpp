@@ -1,9 +1,11 @@
 #ifndef POS_HPP
 #define POS_HPP
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <concepts>
 #include <cstddef>
+#include <functional>
 #include <ostream>
 
 namespace aoc {
@@ -47,7 +49,18 @@ namespace aoc {
 
         template <typename U> requires std::is_arithmetic_v<U>
         [[nodiscard]] T manhattan(const pos<U>& another) const {
-            return std::abs(x - another.x) + std::abs(y - another.y);
+            if constexpr (std::is_unsigned_v<T> && std::is_unsigned_v<U>)
+                return (x > another.x ? x - another.x : another.x - x) + (y > another.y ? y - another.y : another.y - y);
+            else
+                return std::abs(x - another.x) + std::abs(y - another.y);
+        }
+
+        template <typename U> requires std::is_arithmetic_v<U>
+        [[nodiscard]] T chebyshev(const pos<U>& another) const {
+            if constexpr (std::is_unsigned_v<T> && std::is_unsigned_v<U>)
+                return std::max<T>(x > another.x ? x - another.x : another.x - x, y > another.y ? y - another.y : another.y - y);
+            else
+                return std::max<T>(std::abs(x - another.x), std::abs(y - another.y));
         }
 
         template <typename U> requires std::is_arithmetic_v<U>
@@ -128,4 +141,12 @@ namespace aoc {
     }
 }   // namespace aoc
 
+template <typename T> requires std::is_arithmetic_v<T>
+struct std::hash<aoc::pos<T>> {
+    [[nodiscard]] std::size_t operator()(const aoc::pos<T>& p) const noexcept {
+        const auto hx = std::hash<T>{}(p.x);
+        return hx ^ (std::hash<T>{}(p.y) + 0x9E3779B97F4A7C15ULL + (hx << 6) + (hx >> 2));
+    }
+};
+
 #endif  // POS_HPP
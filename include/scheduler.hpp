@@ -0,0 +1,148 @@
+#ifndef SCHEDULER_HPP
+#define SCHEDULER_HPP
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace aoc {
+    /// Runs a discrete event simulation: events are scheduled at future times and handled in time order, jumping straight over idle time.
+    /// Events are kept in a radix heap whose buckets only ever append, so events due at the same time come out in the order they were scheduled,
+    /// and all of them sit together in the lowest bucket once it is their turn.
+    template <typename Event, std::unsigned_integral Time = std::uint64_t>
+    class event_scheduler {
+    public:
+        [[nodiscard]] constexpr bool empty() const noexcept {
+            return size_ == 0;
+        }
+
+        [[nodiscard]] constexpr std::size_t size() const noexcept {
+            return size_;
+        }
+
+        /// Returns the time of the last event handed out, which is when newly scheduled events may start.
+        [[nodiscard]] constexpr Time now() const noexcept {
+            return now_;
+        }
+
+        /// Returns the time of the next event, throwing `std::out_of_range` when there is none.
+        [[nodiscard]] Time next_time() const {
+            if (empty())
+                throw std::out_of_range{"next_time"};
+            if (head_ < buckets_[0].size())
+                return last_;
+            std::size_t i = 1;
+            while (buckets_[i].empty())
+                ++i;
+            auto result = std::numeric_limits<Time>::max();
+            for (const auto& item : buckets_[i])
+                result = std::min(result, item.first);
+            return result;
+        }
+
+        /// Schedules `event` at time `at`, which must not be before `now()`.
+        void schedule(Time at, Event event) {
+            if (at < now_)
+                throw std::invalid_argument{"at"};
+            buckets_[bucket_of(at)].emplace_back(at, std::move(event));
+            ++size_;
+        }
+
+        /// Schedules `event` `delay` time units after `now()`.
+        void schedule_after(Time delay, Event event) {
+            schedule(now_ + delay, std::move(event));
+        }
+
+        /// Removes and returns the next event, advancing `now()` to its time. Throws `std::out_of_range` when there is none.
+        std::pair<Time, Event> pop() {
+            settle();
+            auto& bucket = buckets_[0];
+            auto item = std::move(bucket[head_++]);
+            if (head_ == bucket.size()) {
+                bucket.clear();
+                head_ = 0;
+            }
+            --size_;
+            now_ = item.first;
+            return item;
+        }
+
+        /// Removes every event due at the next time, in the order they were scheduled, and advances `now()` to that time.
+        /// The returned events stay valid until the next batch is taken. Events scheduled for `now()` meanwhile form the next batch.
+        /// Throws `std::out_of_range` when there are no events.
+        std::span<Event> pop_batch() {
+            settle();
+            auto& bucket = buckets_[0];
+            batch_.clear();
+            for (auto i = head_; i < bucket.size(); ++i)
+                batch_.push_back(std::move(bucket[i].second));
+            bucket.clear();
+            head_ = 0;
+            size_ -= batch_.size();
+            now_ = last_;
+            return batch_;
+        }
+
+        /// Calls `handler(time, event)` for every event due no later than `until`, including those the handler schedules meanwhile,
+        /// and returns how many were handled.
+        template <typename Handler>
+        std::size_t run(Handler handler, Time until = std::numeric_limits<Time>::max()) {
+            std::size_t handled = 0;
+            while (!empty() && next_time() <= until) {
+                auto [time, event] = pop();
+                std::invoke(handler, time, std::move(event));
+                ++handled;
+            }
+            return handled;
+        }
+
+        /// Drops every event and rewinds `now()` to 0.
+        void clear() noexcept {
+            for (auto& bucket : buckets_)
+                bucket.clear();
+            size_ = 0;
+            head_ = 0;
+            last_ = 0;
+            now_ = 0;
+        }
+
+    private:
+        std::array<std::vector<std::pair<Time, Event>>, std::numeric_limits<Time>::digits + 1> buckets_;
+        std::vector<Event> batch_;
+        std::size_t size_ = 0;
+        std::size_t head_ = 0;
+        Time last_ = 0;
+        Time now_ = 0;
+
+        [[nodiscard]] constexpr std::size_t bucket_of(Time at) const noexcept {
+            return static_cast<std::size_t>(std::bit_width(static_cast<Time>(at ^ last_)));
+        }
+
+        /// Refills the lowest bucket from the first non-empty one once it runs out, keeping the order of events due at the same time.
+        void settle() {
+            if (empty())
+                throw std::out_of_range{"pop"};
+            if (head_ < buckets_[0].size())
+                return;
+            std::size_t i = 1;
+            while (buckets_[i].empty())
+                ++i;
+            last_ = std::numeric_limits<Time>::max();
+            for (const auto& item : buckets_[i])
+                last_ = std::min(last_, item.first);
+            for (auto& item : buckets_[i])
+                buckets_[bucket_of(item.first)].push_back(std::move(item));
+            buckets_[i].clear();
+        }
+    };
+}   // namespace aoc
+
+#endif  // SCHEDULER_HPP
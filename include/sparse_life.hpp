@@ -0,0 +1,272 @@
+#ifndef SPARSE_LIFE_HPP
+#define SPARSE_LIFE_HPP
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
+#include "area.hpp"
+#include "grid.hpp"
+#include "life.hpp"
+#include "pos.hpp"
+
+namespace aoc {
+    namespace detail {
+        /// Open-addressing hash table from 64-bit keys to small values with linear probing. The all-ones key marks an empty slot.
+        template <typename V>
+        class flat_table {
+        public:
+            static constexpr std::uint64_t empty_key = ~std::uint64_t{0};
+
+            [[nodiscard]] constexpr std::size_t size() const noexcept {
+                return size_;
+            }
+
+            /// Returns the value for `key`, inserting a default one if it is missing.
+            V& operator[](std::uint64_t key) {
+                if ((size_ + 1) * 2 > keys_.size())
+                    grow();
+                auto i = slot(key);
+                while (keys_[i] != key) {
+                    if (keys_[i] == empty_key) {
+                        keys_[i] = key;
+                        values_[i] = V{};
+                        ++size_;
+                        break;
+                    }
+                    i = (i + 1) & mask_;
+                }
+                return values_[i];
+            }
+
+            [[nodiscard]] const V* find(std::uint64_t key) const noexcept {
+                if (size_ == 0)
+                    return nullptr;
+                for (auto i = slot(key); keys_[i] != empty_key; i = (i + 1) & mask_)
+                    if (keys_[i] == key)
+                        return &values_[i];
+                return nullptr;
+            }
+
+            /// Removes `key`, shifting later entries of its probe run back so lookups never need tombstones.
+            bool erase(std::uint64_t key) noexcept {
+                if (size_ == 0)
+                    return false;
+                auto i = slot(key);
+                while (keys_[i] != key) {
+                    if (keys_[i] == empty_key)
+                        return false;
+                    i = (i + 1) & mask_;
+                }
+                for (auto j = (i + 1) & mask_; keys_[j] != empty_key; j = (j + 1) & mask_) {
+                    const auto home = slot(keys_[j]);
+                    if (((j - home) & mask_) >= ((j - i) & mask_)) {
+                        keys_[i] = keys_[j];
+                        values_[i] = values_[j];
+                        i = j;
+                    }
+                }
+                keys_[i] = empty_key;
+                --size_;
+                return true;
+            }
+
+            /// Empties the table but keeps its capacity.
+            void clear() noexcept {
+                std::ranges::fill(keys_, empty_key);
+                size_ = 0;
+            }
+
+            template <typename Func>
+            void for_each(Func&& func) const {
+                for (std::size_t i = 0; i < keys_.size(); ++i)
+                    if (keys_[i] != empty_key)
+                        func(keys_[i], values_[i]);
+            }
+
+        private:
+            std::vector<std::uint64_t> keys_;
+            std::vector<V> values_;
+            std::size_t size_ = 0;
+            std::size_t mask_ = 0;
+
+            [[nodiscard]] std::size_t slot(std::uint64_t key) const noexcept {
+                return static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ULL) >> 32) & mask_;
+            }
+
+            void grow() {
+                auto keys = std::move(keys_);
+                auto values = std::move(values_);
+                const auto capacity = std::max<std::size_t>(16, keys.size() * 2);
+                keys_.assign(capacity, empty_key);
+                values_.assign(capacity, V{});
+                mask_ = capacity - 1;
+                size_ = 0;
+                for (std::size_t i = 0; i < keys.size(); ++i)
+                    if (keys[i] != empty_key)
+                        (*this)[keys[i]] = values[i];
+            }
+        };
+    }   // namespace detail
+
+    /// Represents a set of positions held in one flat hash table, each position packed into a 64-bit key.
+    /// Each coordinate must lie in `(-2^31, 2^31 - 1)`.
+    template <std::signed_integral T = long long>
+    class flat_pos_set {
+    public:
+        [[nodiscard]] static constexpr std::uint64_t pack(const pos<T>& p) noexcept {
+            return static_cast<std::uint64_t>(static_cast<std::uint32_t>(p.x) ^ 0x80000000U) << 32 | (static_cast<std::uint32_t>(p.y) ^ 0x80000000U);
+        }
+
+        [[nodiscard]] static constexpr pos<T> unpack(std::uint64_t key) noexcept {
+            return pos<T>{static_cast<T>(static_cast<std::int32_t>(static_cast<std::uint32_t>(key >> 32) ^ 0x80000000U)),
+                static_cast<T>(static_cast<std::int32_t>(static_cast<std::uint32_t>(key) ^ 0x80000000U))};
+        }
+
+        [[nodiscard]] constexpr std::size_t size() const noexcept {
+            return table_.size();
+        }
+
+        [[nodiscard]] constexpr bool empty() const noexcept {
+            return table_.size() == 0;
+        }
+
+        [[nodiscard]] bool contains(const pos<T>& p) const noexcept {
+            return table_.find(pack(p)) != nullptr;
+        }
+
+        /// Adds `p` and returns whether it was missing.
+        bool insert(const pos<T>& p) {
+            const auto before = table_.size();
+            table_[pack(p)] = 1;
+            return table_.size() != before;
+        }
+
+        bool erase(const pos<T>& p) noexcept {
+            return table_.erase(pack(p));
+        }
+
+        void clear() noexcept {
+            table_.clear();
+        }
+
+        template <typename Func>
+        void for_each(Func&& func) const {
+            table_.for_each([&func](std::uint64_t key, std::uint8_t) { func(unpack(key)); });
+        }
+
+    private:
+        detail::flat_table<std::uint8_t> table_;
+    };
+
+    /// Life-like cellular automaton on an unbounded plane that only stores live cells, whose coordinates must stay within 32 bits.
+    /// Each step counts live neighbours into a flat hash map keyed by packed positions, so work follows the population rather than the area.
+    template <std::signed_integral T = long long>
+    class sparse_life {
+    public:
+        /// The rule may not give birth to cells with no live neighbours, since that would fill the plane.
+        explicit sparse_life(life_rule rule = life_rule{}, connectivity conn = connectivity::eight) : rule_{rule}, conn_{conn} {
+            if (rule.birth() & 1)
+                throw std::invalid_argument{"rule"};
+        }
+
+        [[nodiscard]] constexpr const life_rule& rule() const noexcept {
+            return rule_;
+        }
+
+        [[nodiscard]] constexpr std::size_t population() const noexcept {
+            return live_.size();
+        }
+
+        [[nodiscard]] constexpr const flat_pos_set<T>& cells() const noexcept {
+            return live_;
+        }
+
+        [[nodiscard]] bool test(const pos<T>& p) const noexcept {
+            return live_.contains(p);
+        }
+
+        void set(const pos<T>& p, bool alive = true) {
+            if (alive) {
+                live_.insert(p);
+                if (!stale_)
+                    include(p);
+            } else if (live_.erase(p)) {
+                stale_ = true;
+            }
+        }
+
+        /// Returns the smallest area holding every live cell, which is a single cell at the origin when there are none.
+        [[nodiscard]] area<T> bounds() const {
+            if (stale_) {
+                empty_bounds_ = true;
+                live_.for_each([this](const pos<T>& p) { include(p); });
+                stale_ = false;
+            }
+            return empty_bounds_ ? area<T>{0} : bounds_;
+        }
+
+        /// Advances the automaton by up to `generations` steps, and returns whether the last step changed any cell.
+        /// Stops early once a step changes nothing, since every later step would be the same.
+        bool step(std::size_t generations = 1) {
+            // the low nibble counts live neighbours and bit 4 marks a live cell
+            constexpr std::uint8_t alive = 0x10;
+            constexpr std::uint64_t column = std::uint64_t{1} << 32;
+            const std::uint64_t four[] = {column, 0 - column, 1, 0 - std::uint64_t{1}};
+            const std::uint64_t eight[] = {column, 0 - column, 1, 0 - std::uint64_t{1}, column + 1, column - 1, 0 - column + 1, 0 - column - 1};
+            const auto offsets = conn_ == connectivity::eight ? std::span<const std::uint64_t>{eight} : std::span<const std::uint64_t>{four};
+
+            bool changed = true;
+            for (std::size_t g = 0; g < generations && changed; ++g) {
+                counts_.clear();
+                live_.for_each([&](const pos<T>& p) {
+                    const auto key = flat_pos_set<T>::pack(p);
+                    counts_[key] |= alive;
+                    for (const auto offset : offsets)
+                        ++counts_[key + offset];
+                });
+
+                changed = false;
+                live_.clear();
+                empty_bounds_ = true;
+                stale_ = false;
+                counts_.for_each([&](std::uint64_t key, std::uint8_t value) {
+                    const bool wasAlive = value & alive;
+                    const bool isAlive = rule_.next(wasAlive, value & 0x0F);
+                    changed |= wasAlive != isAlive;
+                    if (isAlive) {
+                        const auto p = flat_pos_set<T>::unpack(key);
+                        live_.insert(p);
+                        include(p);
+                    }
+                });
+            }
+            return changed;
+        }
+
+    private:
+        life_rule rule_;
+        connectivity conn_;
+        flat_pos_set<T> live_;
+        detail::flat_table<std::uint8_t> counts_;
+        mutable area<T> bounds_{0};
+        mutable bool empty_bounds_ = true;
+        mutable bool stale_ = false;
+
+        void include(const pos<T>& p) const noexcept {
+            if (empty_bounds_) {
+                bounds_ = area<T>{p.x, p.y, p.x, p.y};
+                empty_bounds_ = false;
+                return;
+            }
+            bounds_.min_x = std::min(bounds_.min_x, p.x);
+            bounds_.max_x = std::max(bounds_.max_x, p.x);
+            bounds_.min_y = std::min(bounds_.min_y, p.y);
+            bounds_.max_y = std::max(bounds_.max_y, p.y);
+        }
+    };
+}   // namespace aoc
+
+#endif  // SPARSE_LIFE_HPP
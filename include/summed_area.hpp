@@ -0,0 +1,108 @@
+#ifndef SUMMED_AREA_HPP
+#define SUMMED_AREA_HPP
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+#include "area.hpp"
+#include "pos.hpp"
+
+namespace aoc {
+    /// Represents a rectangle of a grid together with the sum of its cells.
+    template <typename T>
+    struct area_sum {
+        T sum;
+        area<std::size_t> bounds;
+    };
+
+    /// Represents a 2D prefix sum table answering rectangle sum queries in O(1).
+    template <typename T = long long> requires std::is_arithmetic_v<T>
+    class summed_area_table {
+    public:
+        template <typename Grid, typename Proj = std::identity>
+        constexpr explicit summed_area_table(const Grid& grid, Proj proj = {}) : width_{grid.width()}, height_{grid.height()}, sums_((width_ + 1) * (height_ + 1)) {
+            std::vector<T> row(width_);
+            for (std::size_t y = 0; y < height_; ++y) {
+                T running{};
+                for (std::size_t x = 0; x < width_; ++x) {
+                    running += static_cast<T>(std::invoke(proj, grid.at(x, y)));
+                    row[x] = running;
+                }
+
+                // independent lanes, so this loop vectorises
+                const T* above = sums_.data() + y * (width_ + 1) + 1;
+                T* out = sums_.data() + (y + 1) * (width_ + 1) + 1;
+                for (std::size_t x = 0; x < width_; ++x)
+                    out[x] = above[x] + row[x];
+            }
+        }
+
+        [[nodiscard]] constexpr std::size_t width() const noexcept {
+            return width_;
+        }
+
+        [[nodiscard]] constexpr std::size_t height() const noexcept {
+            return height_;
+        }
+
+        /// Returns the sum of the cells inside `a`, clipped to the grid.
+        template <std::integral U>
+        [[nodiscard]] constexpr T sum(const area<U>& a) const noexcept {
+            if constexpr (std::is_signed_v<U>)
+                if (a.max_x < 0 || a.max_y < 0)
+                    return T{};
+            if (empty())
+                return T{};
+            const auto minX = static_cast<std::size_t>(std::max<U>(a.min_x, 0));
+            const auto minY = static_cast<std::size_t>(std::max<U>(a.min_y, 0));
+            const auto maxX = std::min(static_cast<std::size_t>(a.max_x), width_ - 1);
+            const auto maxY = std::min(static_cast<std::size_t>(a.max_y), height_ - 1);
+            if (minX > maxX || minY > maxY)
+                return T{};
+            return at(maxX + 1, maxY + 1) - at(minX, maxY + 1) - at(maxX + 1, minY) + at(minX, minY);
+        }
+
+        /// Returns the rectangle with the largest sum, in O(rows^2 * cols).
+        [[nodiscard]] area_sum<T> max_sum_area() const {
+            if (empty())
+                throw std::out_of_range{"empty"};
+
+            area_sum<T> best{at(1, 1), area<std::size_t>{0}};
+            for (std::size_t top = 0; top < height_; ++top) {
+                for (std::size_t bottom = top; bottom < height_; ++bottom) {
+                    T current{};
+                    std::size_t start = 0;
+                    for (std::size_t x = 0; x < width_; ++x) {
+                        const auto column = at(x + 1, bottom + 1) - at(x, bottom + 1) - at(x + 1, top) + at(x, top);
+                        if (x == 0 || current <= 0) {
+                            current = column;
+                            start = x;
+                        } else {
+                            current += column;
+                        }
+                        if (current > best.sum)
+                            best = {current, area<std::size_t>{x, bottom, start, top}};
+                    }
+                }
+            }
+            return best;
+        }
+
+    private:
+        std::size_t width_;
+        std::size_t height_;
+        std::vector<T> sums_;
+
+        [[nodiscard]] constexpr bool empty() const noexcept {
+            return width_ == 0 || height_ == 0;
+        }
+
+        [[nodiscard]] constexpr T at(std::size_t x, std::size_t y) const noexcept {
+            return sums_[y * (width_ + 1) + x];
+        }
+    };
+}   // namespace aoc
+
+#endif  // SUMMED_AREA_HPP
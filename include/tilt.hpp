@@ -0,0 +1,296 @@
+#ifndef TILT_HPP
+#define TILT_HPP
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+#include "grid.hpp"
+#include "pos.hpp"
+
+namespace aoc {
+    /// Rolls every `movable` cell of the grid towards `dir` until it meets the edge, a blocker or another movable cell.
+    /// Cells that are neither `movable` nor `empty` are blockers and never move.
+    /// `direction::north` rolls towards row 0, which is `pos::down()` rather than `pos::up()`.
+    /// Rows are tilted a run between blockers at a time by counting the movable cells and filling the run in bulk. Columns are
+    /// tilted in two branchless sweeps over whole rows: the first records how many empty cells lie before each cell in its run,
+    /// and the second counts the movable cells from each cell to the end of its run, which stays movable when that count is larger.
+    template <typename T>
+    void tilt(grid<T>& g, direction dir, const T& movable, const T& empty) {
+        const auto width = g.width();
+        const auto height = g.height();
+        T* cells = g.data();
+        if (dir == direction::east || dir == direction::west) {
+            const auto blocked = [&](const T& c) { return c != movable && c != empty; };
+            for (std::size_t y = 0; y < height; ++y) {
+                T* first = cells + y * width;
+                T* const last = first + width;
+                while (first != last) {
+                    T* const stop = std::find_if(first, last, blocked);
+                    const auto count = std::count(first, stop, movable);
+                    if (dir == direction::west) {
+                        std::fill(first, first + count, movable);
+                        std::fill(first + count, stop, empty);
+                    } else {
+                        std::fill(first, stop - count, empty);
+                        std::fill(stop - count, stop, movable);
+                    }
+                    first = stop == last ? last : stop + 1;
+                }
+            }
+            return;
+        }
+
+        const bool north = dir == direction::north;
+        std::vector<std::uint32_t> before(width * height);
+        std::vector<std::uint32_t> run(width);
+        for (std::size_t i = 0; i < height; ++i) {
+            const auto y = north ? i : height - 1 - i;
+            const T* row = cells + y * width;
+            std::uint32_t* counts = before.data() + y * width;
+            for (std::size_t x = 0; x < width; ++x) {
+                const bool blocked = row[x] != movable && row[x] != empty;
+                counts[x] = run[x];
+                run[x] = blocked ? 0 : run[x] + (row[x] == empty);
+            }
+        }
+
+        std::ranges::fill(run, 0);
+        for (std::size_t i = height; i-- > 0;) {
+            const auto y = north ? i : height - 1 - i;
+            T* row = cells + y * width;
+            const std::uint32_t* counts = before.data() + y * width;
+            for (std::size_t x = 0; x < width; ++x) {
+                const T c = row[x];
+                const bool isMovable = c == movable;
+                const bool blocked = !isMovable && c != empty;
+                run[x] = blocked ? 0 : run[x] + isMovable;
+                row[x] = blocked ? c : counts[x] < run[x] ? movable : empty;
+            }
+        }
+    }
+
+    namespace detail {
+        /// Transposes a 64x64 bit matrix in place, where bit `c` of `m[r]` is row `r` and column `c`.
+        constexpr void transpose64(std::array<std::uint64_t, 64>& m) noexcept {
+            std::uint64_t mask = 0x00000000FFFFFFFFULL;
+            for (std::size_t j = 32; j != 0; j >>= 1, mask ^= mask << j) {
+                for (std::size_t k = 0; k < 64; k = ((k | j) + 1) & ~j) {
+                    const auto t = ((m[k] >> j) ^ m[k | j]) & mask;
+                    m[k] ^= t << j;
+                    m[k | j] ^= t;
+                }
+            }
+        }
+
+        /// Transposes a bit matrix stored as `lines` lines of `stride` words into `out`, which gets one line per source bit.
+        inline void transpose_bits(const std::uint64_t* in, std::size_t lines, std::size_t stride, std::uint64_t* out, std::size_t outLines, std::size_t outStride) {
+            std::array<std::uint64_t, 64> block{};
+            for (std::size_t by = 0; by < outStride; ++by) {
+                for (std::size_t bx = 0; bx < stride; ++bx) {
+                    for (std::size_t i = 0; i < 64; ++i)
+                        block[i] = by * 64 + i < lines ? in[(by * 64 + i) * stride + bx] : 0;
+                    transpose64(block);
+                    for (std::size_t j = 0; j < 64 && bx * 64 + j < outLines; ++j)
+                        out[(bx * 64 + j) * outStride + by] = block[j];
+                }
+            }
+        }
+
+        /// Returns the mask of bits `[from, to)` in a word, where `from < to <= 64`.
+        [[nodiscard]] constexpr std::uint64_t bit_range(std::size_t from, std::size_t to) noexcept {
+            return (to == 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << to) - 1) & ~((std::uint64_t{1} << from) - 1);
+        }
+    }   // namespace detail
+
+    /// Represents the movable and blocked cells of a grid as bitboards, and tilts every line with a popcount and two masked writes per run between blockers.
+    /// Movable cells are kept row by row or column by column, whichever the last tilt needed, so a spin cycle transposes only between turns.
+    /// As with `tilt`, `direction::north` is towards row 0, the opposite of `pos::up()`.
+    class tilt_board {
+    public:
+        using word_type = std::uint64_t;
+        static constexpr std::size_t word_bits = 64;
+
+        explicit tilt_board(std::size_t width, std::size_t height)
+            : width_{width}, height_{height}, rowStride_{(width + word_bits - 1) / word_bits}, columnStride_{(height + word_bits - 1) / word_bits},
+              movable_(rowStride_ * height), rowBlocked_(rowStride_ * height), columnBlocked_(columnStride_ * width), scratch_(columnStride_ * width) {}
+
+        /// Creates a board from a grid, where cells equal to `movable` can move and cells that are neither `movable` nor `empty` are blocked.
+        template <typename T, typename Layout>
+        [[nodiscard]] static tilt_board from_grid(const grid<T, Layout>& g, const T& movable, const T& empty) {
+            tilt_board result{g.width(), g.height()};
+            for (std::size_t y = 0; y < g.height(); ++y) {
+                for (std::size_t x = 0; x < g.width(); ++x) {
+                    if (g.at(x, y) == movable)
+                        result.set(x, y);
+                    else if (g.at(x, y) != empty)
+                        result.block(x, y);
+                }
+            }
+            return result;
+        }
+
+        [[nodiscard]] constexpr std::size_t width() const noexcept {
+            return width_;
+        }
+
+        [[nodiscard]] constexpr std::size_t height() const noexcept {
+            return height_;
+        }
+
+        /// Returns whether the cell holds a movable object.
+        [[nodiscard]] bool test(std::size_t x, std::size_t y) const noexcept {
+            const auto [line, bit] = locate(x, y);
+            return movable_[line + bit / word_bits] >> (bit % word_bits) & 1;
+        }
+
+        [[nodiscard]] bool blocked(std::size_t x, std::size_t y) const noexcept {
+            return rowBlocked_[y * rowStride_ + x / word_bits] >> (x % word_bits) & 1;
+        }
+
+        /// Places or removes a movable object, which must not be on a blocked cell.
+        void set(std::size_t x, std::size_t y, bool movable = true) noexcept {
+            const auto [line, bit] = locate(x, y);
+            auto& word = movable_[line + bit / word_bits];
+            const auto mask = word_type{1} << (bit % word_bits);
+            word = movable ? word | mask : word & ~mask;
+        }
+
+        /// Marks a cell as blocked, which must not hold a movable object.
+        void block(std::size_t x, std::size_t y) noexcept {
+            rowBlocked_[y * rowStride_ + x / word_bits] |= word_type{1} << (x % word_bits);
+            columnBlocked_[x * columnStride_ + y / word_bits] |= word_type{1} << (y % word_bits);
+        }
+
+        [[nodiscard]] std::size_t count() const noexcept {
+            std::size_t result = 0;
+            for (const auto word : movable_)
+                result += static_cast<std::size_t>(std::popcount(word));
+            return result;
+        }
+
+        /// Calls `func(p)` for the position of each movable object, row by row.
+        template <typename Func>
+        void for_each(Func&& func) const {
+            const auto rows = row_words();
+            for (std::size_t y = 0; y < height_; ++y) {
+                for (std::size_t w = 0; w < rowStride_; ++w) {
+                    for (auto word = rows[y * rowStride_ + w]; word != 0; word &= word - 1)
+                        func(pos<std::size_t>{w * word_bits + static_cast<std::size_t>(std::countr_zero(word)), y});
+                }
+            }
+        }
+
+        /// Rolls every movable object towards `dir` until it meets the edge, a blocked cell or another object.
+        void tilt(direction dir) {
+            const bool vertical = dir == direction::north || dir == direction::south;
+            if (vertical != columns_) {
+                scratch_.resize(vertical ? columnStride_ * width_ : rowStride_ * height_);
+                if (vertical)
+                    detail::transpose_bits(movable_.data(), height_, rowStride_, scratch_.data(), width_, columnStride_);
+                else
+                    detail::transpose_bits(movable_.data(), width_, columnStride_, scratch_.data(), height_, rowStride_);
+                movable_.swap(scratch_);
+                columns_ = vertical;
+            }
+
+            const auto lines = vertical ? width_ : height_;
+            const auto length = vertical ? height_ : width_;
+            const auto stride = vertical ? columnStride_ : rowStride_;
+            const auto& blockers = vertical ? columnBlocked_ : rowBlocked_;
+            const bool forward = dir == direction::south || dir == direction::east;
+            for (std::size_t line = 0; line < lines; ++line)
+                tilt_line(movable_.data() + line * stride, blockers.data() + line * stride, length, forward);
+        }
+
+        [[nodiscard]] bool operator==(const tilt_board& rhs) const {
+            return width_ == rhs.width_ && height_ == rhs.height_ && rowBlocked_ == rhs.rowBlocked_ && row_words() == rhs.row_words();
+        }
+
+        /// Hashes the movable objects, so equal boards hash the same whichever way their objects are stored.
+        [[nodiscard]] std::size_t hash() const {
+            std::size_t result = width_;
+            for (const auto word : row_words())
+                result ^= static_cast<std::size_t>(word) + 0x9E3779B97F4A7C15ULL + (result << 6) + (result >> 2);
+            return result;
+        }
+
+    private:
+        std::size_t width_;
+        std::size_t height_;
+        std::size_t rowStride_;
+        std::size_t columnStride_;
+        bool columns_ = false;
+        std::vector<word_type> movable_;
+        std::vector<word_type> rowBlocked_;
+        std::vector<word_type> columnBlocked_;
+        std::vector<word_type> scratch_;
+
+        /// Returns the first word of the line holding the cell and the cell's bit within that line.
+        [[nodiscard]] std::pair<std::size_t, std::size_t> locate(std::size_t x, std::size_t y) const noexcept {
+            return columns_ ? std::pair{x * columnStride_, y} : std::pair{y * rowStride_, x};
+        }
+
+        /// Returns the movable objects row by row, transposing a copy when they are stored by column.
+        [[nodiscard]] std::vector<word_type> row_words() const {
+            if (!columns_)
+                return movable_;
+            std::vector<word_type> rows(rowStride_ * height_);
+            detail::transpose_bits(movable_.data(), width_, columnStride_, rows.data(), height_, rowStride_);
+            return rows;
+        }
+
+        /// Returns the first blocked bit at or after `from`, or `length` if there is none.
+        [[nodiscard]] static std::size_t next_blocked(const word_type* blockers, std::size_t from, std::size_t length) noexcept {
+            auto w = from / word_bits;
+            auto word = blockers[w] & ~((word_type{1} << (from % word_bits)) - 1);
+            const auto words = (length + word_bits - 1) / word_bits;
+            while (word == 0) {
+                if (++w == words)
+                    return length;
+                word = blockers[w];
+            }
+            return std::min(length, w * word_bits + static_cast<std::size_t>(std::countr_zero(word)));
+        }
+
+        /// Packs the movable bits of every run between blockers against the start or the end of the run.
+        static void tilt_line(word_type* line, const word_type* blockers, std::size_t length, bool forward) noexcept {
+            for (std::size_t start = 0; start < length;) {
+                const auto stop = next_blocked(blockers, start, length);
+                if (stop > start) {
+                    std::size_t count = 0;
+                    for_each_word(start, stop, [&](std::size_t w, word_type mask) {
+                        count += static_cast<std::size_t>(std::popcount(line[w] & mask));
+                        line[w] &= ~mask;
+                    });
+                    if (count > 0)
+                        for_each_word(forward ? stop - count : start, forward ? stop : start + count, [&](std::size_t w, word_type mask) { line[w] |= mask; });
+                }
+                start = stop + 1;
+            }
+        }
+
+        /// Calls `func(w, mask)` for each word overlapping bits `[from, to)` with the mask of those bits in it.
+        template <typename Func>
+        static void for_each_word(std::size_t from, std::size_t to, Func&& func) {
+            while (from < to) {
+                const auto w = from / word_bits;
+                const auto end = std::min(to, (w + 1) * word_bits);
+                func(w, detail::bit_range(from % word_bits, end - w * word_bits));
+                from = end;
+            }
+        }
+    };
+}   // namespace aoc
+
+template <>
+struct std::hash<aoc::tilt_board> {
+    [[nodiscard]] std::size_t operator()(const aoc::tilt_board& board) const {
+        return board.hash();
+    }
+};
+
+#endif  // TILT_HPP
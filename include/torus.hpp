@@ -0,0 +1,138 @@
+#ifndef TORUS_HPP
+#define TORUS_HPP
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include "area.hpp"
+#include "pos.hpp"
+
+namespace aoc {
+    namespace detail {
+        /// Returns an axis length as a `fast_mod` divisor, throwing if it does not fit in 32 bits.
+        template <std::integral T>
+        [[nodiscard]] constexpr std::uint32_t checked_length(T length) {
+            if (static_cast<std::make_unsigned_t<T>>(length) > std::numeric_limits<std::uint32_t>::max())
+                throw std::out_of_range{"length"};
+            return static_cast<std::uint32_t>(length);
+        }
+    }   // namespace detail
+
+    /// Computes `value mod divisor` using a precomputed multiply-shift reciprocal instead of a division.
+    class fast_mod {
+    public:
+        constexpr explicit fast_mod(std::uint32_t divisor) : divisor_{divisor} {
+            if (divisor == 0)
+                throw std::invalid_argument{"divisor"};
+            reciprocal_ = (std::uint64_t{1} << 32) / divisor;
+            bias_ = static_cast<std::uint32_t>((std::uint64_t{1} << 32) % divisor);
+        }
+
+        [[nodiscard]] constexpr std::uint32_t divisor() const noexcept {
+            return divisor_;
+        }
+
+        /// Reduces an unsigned 32-bit value; the estimated quotient is at most one too small, so one masked subtraction fixes it.
+        [[nodiscard]] constexpr std::uint32_t reduce(std::uint32_t value) const noexcept {
+            const auto q = static_cast<std::uint32_t>((value * reciprocal_) >> 32);
+            const auto r = value - q * divisor_;
+            return r - (divisor_ & -static_cast<std::uint32_t>(r >= divisor_));
+        }
+
+        /// Returns the non-negative remainder. Unsigned values are read as two's complement so `0 - 1` wraps to `divisor - 1`.
+        template <std::integral T>
+        [[nodiscard]] constexpr T operator()(T value) const noexcept {
+            constexpr std::int64_t limit = std::int64_t{1} << 32;
+            const auto v = static_cast<std::int64_t>(static_cast<std::make_signed_t<T>>(value));
+            if (v < -limit || v >= limit) [[unlikely]]
+                return static_cast<T>((v % divisor_ + divisor_) % divisor_);
+
+            const auto r = reduce(static_cast<std::uint32_t>(v));
+            const auto adjusted = r - (bias_ & -static_cast<std::uint32_t>(v < 0));
+            return static_cast<T>(adjusted + (divisor_ & -static_cast<std::uint32_t>(adjusted > r)));
+        }
+
+    private:
+        std::uint32_t divisor_;
+        std::uint32_t bias_ = 0;
+        std::uint64_t reciprocal_ = 0;
+    };
+
+    /// Represents an area whose opposite edges are joined, so every position maps back into it.
+    template <std::integral T = std::size_t>
+    class torus {
+    public:
+        constexpr explicit torus(const area<T>& bounds) : bounds_{bounds}, mod_x_{detail::checked_length(bounds.cols())}, mod_y_{detail::checked_length(bounds.rows())} {}
+
+        [[nodiscard]] constexpr const area<T>& bounds() const noexcept {
+            return bounds_;
+        }
+
+        [[nodiscard]] constexpr pos<T> wrap(const pos<T>& p) const noexcept {
+            return pos<T>{static_cast<T>(bounds_.min_x + mod_x_(static_cast<T>(p.x - bounds_.min_x))), static_cast<T>(bounds_.min_y + mod_y_(static_cast<T>(p.y - bounds_.min_y)))};
+        }
+
+        [[nodiscard]] constexpr std::array<pos<T>, 4> neighbours(const pos<T>& p, T distance = 1) const noexcept {
+            const auto n = p.neighbours(distance);
+            return { wrap(n[0]), wrap(n[1]), wrap(n[2]), wrap(n[3]) };
+        }
+
+        [[nodiscard]] constexpr std::array<pos<T>, 4> neighbours_diag(const pos<T>& p, T distance = 1) const noexcept {
+            const auto n = p.neighbours_diag(distance);
+            return { wrap(n[0]), wrap(n[1]), wrap(n[2]), wrap(n[3]) };
+        }
+
+    private:
+        area<T> bounds_;
+        fast_mod mod_x_;
+        fast_mod mod_y_;
+    };
+
+    /// Presents a grid as infinitely tiled in both directions.
+    template <typename Grid>
+    class torus_view {
+    public:
+        constexpr explicit torus_view(Grid& grid) : grid_{&grid}, mod_x_{detail::checked_length(grid.width())}, mod_y_{detail::checked_length(grid.height())} {}
+
+        [[nodiscard]] constexpr Grid& base() const noexcept {
+            return *grid_;
+        }
+
+        template <std::integral U>
+        [[nodiscard]] constexpr pos<U> wrap(const pos<U>& p) const noexcept {
+            return pos<U>{mod_x_(p.x), mod_y_(p.y)};
+        }
+
+        template <std::integral U>
+        [[nodiscard]] constexpr std::array<pos<U>, 4> neighbours(const pos<U>& p, U distance = 1) const noexcept {
+            const auto n = p.neighbours(distance);
+            return { wrap(n[0]), wrap(n[1]), wrap(n[2]), wrap(n[3]) };
+        }
+
+        template <std::integral U>
+        [[nodiscard]] constexpr std::array<pos<U>, 4> neighbours_diag(const pos<U>& p, U distance = 1) const noexcept {
+            const auto n = p.neighbours_diag(distance);
+            return { wrap(n[0]), wrap(n[1]), wrap(n[2]), wrap(n[3]) };
+        }
+
+        template <std::integral U>
+        [[nodiscard]] constexpr decltype(auto) at(const pos<U>& p) const noexcept {
+            return grid_->at(wrap(p));
+        }
+
+        template <std::integral U>
+        [[nodiscard]] constexpr decltype(auto) operator[](const pos<U>& p) const noexcept {
+            return grid_->at(wrap(p));
+        }
+
+    private:
+        Grid* grid_;
+        fast_mod mod_x_;
+        fast_mod mod_y_;
+    };
+}   // namespace aoc
+
+#endif  // TORUS_HPP
@@ -0,0 +1,287 @@
+#ifndef TRANSFORM_HPP
+#define TRANSFORM_HPP
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "grid.hpp"
+#include "pos.hpp"
+
+namespace aoc {
+    namespace detail {
+        inline constexpr std::size_t transform_block = 32;
+
+        template <typename T, typename Layout>
+        concept byte_rows = std::same_as<Layout, row_major> && sizeof(T) == 1 && std::is_trivially_copyable_v<T>;
+
+        /// Transposes an 8x8 block of bytes held as one little-endian word per row, by swapping 4x4, 2x2 then 1x1 sub-blocks.
+        constexpr void transpose_8x8(std::array<std::uint64_t, 8>& rows) noexcept {
+            for (std::size_t i = 0; i < 4; ++i) {
+                const auto t = ((rows[i] >> 32) ^ rows[i + 4]) & 0x00000000FFFFFFFFULL;
+                rows[i] ^= t << 32;
+                rows[i + 4] ^= t;
+            }
+            for (const std::size_t i : {0, 1, 4, 5}) {
+                const auto t = ((rows[i] >> 16) ^ rows[i + 2]) & 0x0000FFFF0000FFFFULL;
+                rows[i] ^= t << 16;
+                rows[i + 2] ^= t;
+            }
+            for (std::size_t i = 0; i < 8; i += 2) {
+                const auto t = ((rows[i] >> 8) ^ rows[i + 1]) & 0x00FF00FF00FF00FFULL;
+                rows[i] ^= t << 8;
+                rows[i + 1] ^= t;
+            }
+        }
+
+        /// Transposes `height` rows of `width` bytes, where `src(y)` and `dst(x)` return pointers to the start of a row.
+        template <typename Src, typename Dst>
+        void transpose_bytes(std::size_t width, std::size_t height, Src src, Dst dst) {
+            std::size_t fullWidth = 0;
+            std::size_t fullHeight = 0;
+            if constexpr (std::endian::native == std::endian::little) {
+                fullWidth = width & ~std::size_t{7};
+                fullHeight = height & ~std::size_t{7};
+                std::array<std::uint64_t, 8> rows{};
+                for (std::size_t by = 0; by < fullHeight; by += 8) {
+                    for (std::size_t bx = 0; bx < fullWidth; bx += 8) {
+                        for (std::size_t i = 0; i < 8; ++i)
+                            std::memcpy(&rows[i], src(by + i) + bx, 8);
+                        transpose_8x8(rows);
+                        for (std::size_t i = 0; i < 8; ++i)
+                            std::memcpy(dst(bx + i) + by, &rows[i], 8);
+                    }
+                }
+            }
+
+            for (std::size_t y = 0; y < height; ++y)
+                for (std::size_t x = fullWidth; x < width; ++x)
+                    dst(x)[y] = src(y)[x];
+            for (std::size_t y = fullHeight; y < height; ++y)
+                for (std::size_t x = 0; x < fullWidth; ++x)
+                    dst(x)[y] = src(y)[x];
+        }
+
+        /// Calls `copy(x, y)` for every cell, one square block at a time so both source and destination stay cached.
+        template <std::invocable<std::size_t, std::size_t> Func>
+        constexpr void for_each_blocked(std::size_t width, std::size_t height, Func copy) {
+            for (std::size_t by = 0; by < height; by += transform_block)
+                for (std::size_t bx = 0; bx < width; bx += transform_block)
+                    for (std::size_t y = by; y < std::min(by + transform_block, height); ++y)
+                        for (std::size_t x = bx; x < std::min(bx + transform_block, width); ++x)
+                            copy(x, y);
+        }
+
+        inline void check_rectangular(const std::vector<std::string>& lines) {
+            if (!lines.empty() && std::ranges::any_of(lines, [&lines](const auto& line) { return line.size() != lines[0].size(); }))
+                throw std::invalid_argument{"lines"};
+        }
+
+        template <typename T, typename Layout>
+        void check_square(const grid<T, Layout>& g) {
+            if (g.width() != g.height())
+                throw std::invalid_argument{"grid"};
+        }
+    }   // namespace detail
+
+    /// Mirrors a grid left to right in place.
+    template <typename T, typename Layout>
+    void flip_x_in_place(grid<T, Layout>& g) {
+        if constexpr (std::same_as<Layout, row_major>) {
+            for (std::size_t y = 0; y < g.height(); ++y)
+                std::reverse(g.data() + y * g.width(), g.data() + (y + 1) * g.width());
+        } else {
+            for (std::size_t y = 0; y < g.height(); ++y)
+                for (std::size_t x = 0; x < g.width() / 2; ++x)
+                    std::swap(g.at(x, y), g.at(g.width() - 1 - x, y));
+        }
+    }
+
+    /// Mirrors a grid top to bottom in place.
+    template <typename T, typename Layout>
+    void flip_y_in_place(grid<T, Layout>& g) {
+        for (std::size_t y = 0; y < g.height() / 2; ++y) {
+            if constexpr (std::same_as<Layout, row_major>) {
+                std::swap_ranges(g.data() + y * g.width(), g.data() + (y + 1) * g.width(), g.data() + (g.height() - 1 - y) * g.width());
+            } else {
+                for (std::size_t x = 0; x < g.width(); ++x)
+                    std::swap(g.at(x, y), g.at(x, g.height() - 1 - y));
+            }
+        }
+    }
+
+    template <typename T, typename Layout>
+    void rotate_180_in_place(grid<T, Layout>& g) {
+        if constexpr (std::same_as<Layout, row_major>) {
+            std::reverse(g.data(), g.data() + g.size());
+        } else {
+            flip_x_in_place(g);
+            flip_y_in_place(g);
+        }
+    }
+
+    /// Transposes a square grid in place.
+    template <typename T, typename Layout>
+    void transpose_in_place(grid<T, Layout>& g) {
+        detail::check_square(g);
+        const auto n = g.width();
+        for (std::size_t by = 0; by < n; by += detail::transform_block)
+            for (std::size_t bx = by; bx < n; bx += detail::transform_block)
+                for (std::size_t y = by; y < std::min(by + detail::transform_block, n); ++y)
+                    for (std::size_t x = std::max(bx, y + 1); x < std::min(bx + detail::transform_block, n); ++x)
+                        std::swap(g.at(x, y), g.at(y, x));
+    }
+
+    /// Rotates a square grid a quarter turn clockwise in place.
+    template <typename T, typename Layout>
+    void rotate_cw_in_place(grid<T, Layout>& g) {
+        transpose_in_place(g);
+        flip_x_in_place(g);
+    }
+
+    /// Rotates a square grid a quarter turn anticlockwise in place.
+    template <typename T, typename Layout>
+    void rotate_ccw_in_place(grid<T, Layout>& g) {
+        transpose_in_place(g);
+        flip_y_in_place(g);
+    }
+
+    template <typename T, typename Layout>
+    [[nodiscard]] grid<T, Layout> transpose(const grid<T, Layout>& g) {
+        grid<T, Layout> result{g.height(), g.width()};
+        if constexpr (detail::byte_rows<T, Layout>) {
+            detail::transpose_bytes(g.width(), g.height(),
+                [&g](std::size_t y) { return g.data() + y * g.width(); },
+                [&result](std::size_t x) { return result.data() + x * result.width(); });
+        } else {
+            detail::for_each_blocked(g.width(), g.height(), [&g, &result](std::size_t x, std::size_t y) {
+                result.at(y, x) = g.at(x, y);
+            });
+        }
+        return result;
+    }
+
+    template <typename T, typename Layout>
+    [[nodiscard]] grid<T, Layout> flip_x(grid<T, Layout> g) {
+        flip_x_in_place(g);
+        return g;
+    }
+
+    template <typename T, typename Layout>
+    [[nodiscard]] grid<T, Layout> flip_y(grid<T, Layout> g) {
+        flip_y_in_place(g);
+        return g;
+    }
+
+    template <typename T, typename Layout>
+    [[nodiscard]] grid<T, Layout> rotate_180(grid<T, Layout> g) {
+        rotate_180_in_place(g);
+        return g;
+    }
+
+    template <typename T, typename Layout>
+    [[nodiscard]] grid<T, Layout> rotate_cw(const grid<T, Layout>& g) {
+        auto result = transpose(g);
+        flip_x_in_place(result);
+        return result;
+    }
+
+    template <typename T, typename Layout>
+    [[nodiscard]] grid<T, Layout> rotate_ccw(const grid<T, Layout>& g) {
+        auto result = transpose(g);
+        flip_y_in_place(result);
+        return result;
+    }
+
+    [[nodiscard]] inline std::vector<std::string> transpose(const std::vector<std::string>& lines) {
+        detail::check_rectangular(lines);
+        const auto height = lines.size();
+        const auto width = lines.empty() ? 0 : lines[0].size();
+        std::vector<std::string> result(width, std::string(height, '\0'));
+        detail::transpose_bytes(width, height,
+            [&lines](std::size_t y) { return lines[y].data(); },
+            [&result](std::size_t x) { return result[x].data(); });
+        return result;
+    }
+
+    [[nodiscard]] inline std::vector<std::string> flip_x(std::vector<std::string> lines) {
+        for (auto& line : lines)
+            std::ranges::reverse(line);
+        return lines;
+    }
+
+    [[nodiscard]] inline std::vector<std::string> flip_y(std::vector<std::string> lines) {
+        std::ranges::reverse(lines);
+        return lines;
+    }
+
+    [[nodiscard]] inline std::vector<std::string> rotate_180(std::vector<std::string> lines) {
+        return flip_x(flip_y(std::move(lines)));
+    }
+
+    [[nodiscard]] inline std::vector<std::string> rotate_cw(const std::vector<std::string>& lines) {
+        return flip_x(transpose(lines));
+    }
+
+    [[nodiscard]] inline std::vector<std::string> rotate_ccw(const std::vector<std::string>& lines) {
+        return flip_y(transpose(lines));
+    }
+
+    /// Presents a grid rotated by clockwise quarter turns and optionally mirrored left to right, without copying it.
+    template <typename Grid>
+    class rotated_view {
+    public:
+        constexpr explicit rotated_view(Grid& grid, int turns = 1, bool flipped = false) noexcept : grid_{&grid}, turns_{(turns % 4 + 4) % 4}, flipped_{flipped} {}
+
+        [[nodiscard]] constexpr Grid& base() const noexcept {
+            return *grid_;
+        }
+
+        [[nodiscard]] constexpr std::size_t width() const noexcept {
+            return turns_ % 2 == 0 ? grid_->width() : grid_->height();
+        }
+
+        [[nodiscard]] constexpr std::size_t height() const noexcept {
+            return turns_ % 2 == 0 ? grid_->height() : grid_->width();
+        }
+
+        [[nodiscard]] constexpr decltype(auto) at(std::size_t x, std::size_t y) const noexcept {
+            if (flipped_)
+                x = width() - 1 - x;
+            switch (turns_) {
+                case 1:
+                    return grid_->at(y, grid_->height() - 1 - x);
+                case 2:
+                    return grid_->at(grid_->width() - 1 - x, grid_->height() - 1 - y);
+                case 3:
+                    return grid_->at(grid_->width() - 1 - y, x);
+                default:
+                    return grid_->at(x, y);
+            }
+        }
+
+        template <std::integral U>
+        [[nodiscard]] constexpr decltype(auto) at(const pos<U>& p) const noexcept {
+            return at(static_cast<std::size_t>(p.x), static_cast<std::size_t>(p.y));
+        }
+
+        template <std::integral U>
+        [[nodiscard]] constexpr decltype(auto) operator[](const pos<U>& p) const noexcept {
+            return at(static_cast<std::size_t>(p.x), static_cast<std::size_t>(p.y));
+        }
+
+    private:
+        Grid* grid_;
+        int turns_;
+        bool flipped_;
+    };
+}   // namespace aoc
+
+#endif  // TRANSFORM_HPP
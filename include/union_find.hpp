@@ -0,0 +1,74 @@
+#ifndef UNION_FIND_HPP
+#define UNION_FIND_HPP
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace aoc {
+    /// Represents a disjoint-set forest over `[0, size)`, using path halving and union by size.
+    class union_find {
+    public:
+        union_find() = default;
+
+        explicit union_find(std::size_t size) {
+            reset(size);
+        }
+
+        /// Puts every element back into its own set, reusing the existing storage.
+        void reset(std::size_t size) {
+            parent_.resize(size);
+            size_.assign(size, 1);
+            std::iota(parent_.begin(), parent_.end(), std::uint32_t{0});
+            sets_ = size;
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept {
+            return parent_.size();
+        }
+
+        /// Returns the number of disjoint sets.
+        [[nodiscard]] std::size_t sets() const noexcept {
+            return sets_;
+        }
+
+        [[nodiscard]] std::size_t find(std::size_t i) noexcept {
+            auto x = static_cast<std::uint32_t>(i);
+            while (parent_[x] != x) {
+                parent_[x] = parent_[parent_[x]];
+                x = parent_[x];
+            }
+            return x;
+        }
+
+        /// Merges the sets containing `a` and `b`, returning whether they were separate.
+        bool unite(std::size_t a, std::size_t b) noexcept {
+            auto ra = static_cast<std::uint32_t>(find(a));
+            auto rb = static_cast<std::uint32_t>(find(b));
+            if (ra == rb)
+                return false;
+            if (size_[ra] < size_[rb])
+                std::swap(ra, rb);
+            parent_[rb] = ra;
+            size_[ra] += size_[rb];
+            --sets_;
+            return true;
+        }
+
+        [[nodiscard]] bool same(std::size_t a, std::size_t b) noexcept {
+            return find(a) == find(b);
+        }
+
+        [[nodiscard]] std::size_t set_size(std::size_t i) noexcept {
+            return size_[find(i)];
+        }
+
+    private:
+        std::vector<std::uint32_t> parent_;
+        std::vector<std::uint32_t> size_;
+        std::size_t sets_ = 0;
+    };
+}   // namespace aoc
+
+#endif  // UNION_FIND_HPP
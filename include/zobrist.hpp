@@ -0,0 +1,126 @@
+#ifndef ZOBRIST_HPP
+#define ZOBRIST_HPP
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include "grid.hpp"
+#include "pos.hpp"
+
+namespace aoc {
+    /// Generates Zobrist keys for (cell, value) pairs by mixing them, so no key table is needed however large the grid or value type.
+    template <typename T, typename Hash = std::hash<T>>
+    class zobrist {
+    public:
+        constexpr explicit zobrist(std::uint64_t seed = 0x2545F4914F6CDD1DULL) noexcept : seed_{seed} {}
+
+        [[nodiscard]] constexpr std::uint64_t key(std::size_t cell, const T& value) const noexcept {
+            return mix(mix(seed_ ^ cell) ^ static_cast<std::uint64_t>(Hash{}(value)));
+        }
+
+    private:
+        std::uint64_t seed_;
+
+        /// The splitmix64 finaliser.
+        [[nodiscard]] static constexpr std::uint64_t mix(std::uint64_t z) noexcept {
+            z += 0x9E3779B97F4A7C15ULL;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            return z ^ (z >> 31);
+        }
+    };
+
+    /// Represents a grid that keeps a Zobrist hash of its cells up to date, changing it in O(1) on every write.
+    /// Cells are keyed by row-major position, so equal grids hash the same whatever their layout.
+    template <typename T, typename Layout = row_major, typename Hash = std::hash<T>>
+    class zobrist_grid {
+    public:
+        using value_type = T;
+
+        explicit zobrist_grid(std::size_t width, std::size_t height, const T& value = T{}, zobrist<T, Hash> keys = zobrist<T, Hash>{})
+            : zobrist_grid{grid<T, Layout>{width, height, value}, keys} {}
+
+        explicit zobrist_grid(grid<T, Layout> cells, zobrist<T, Hash> keys = zobrist<T, Hash>{}) : cells_{std::move(cells)}, keys_{keys} {
+            hash_ = rehash();
+        }
+
+        [[nodiscard]] constexpr std::size_t width() const noexcept {
+            return cells_.width();
+        }
+
+        [[nodiscard]] constexpr std::size_t height() const noexcept {
+            return cells_.height();
+        }
+
+        [[nodiscard]] constexpr const grid<T, Layout>& base() const noexcept {
+            return cells_;
+        }
+
+        [[nodiscard]] constexpr const T& at(std::size_t x, std::size_t y) const noexcept {
+            return cells_.at(x, y);
+        }
+
+        template <std::integral U>
+        [[nodiscard]] constexpr const T& at(const pos<U>& p) const noexcept {
+            return cells_.at(p);
+        }
+
+        template <std::integral U>
+        [[nodiscard]] constexpr const T& operator[](const pos<U>& p) const noexcept {
+            return cells_.at(p);
+        }
+
+        void set(std::size_t x, std::size_t y, const T& value) noexcept {
+            auto& cell = cells_.at(x, y);
+            const auto i = y * width() + x;
+            hash_ ^= keys_.key(i, cell) ^ keys_.key(i, value);
+            cell = value;
+        }
+
+        template <std::integral U>
+        void set(const pos<U>& p, const T& value) noexcept {
+            set(static_cast<std::size_t>(p.x), static_cast<std::size_t>(p.y), value);
+        }
+
+        /// Exchanges two cells, as moving an object from one cell to another does.
+        template <std::integral U>
+        void swap(const pos<U>& a, const pos<U>& b) noexcept {
+            const auto value = cells_.at(a);
+            set(a, cells_.at(b));
+            set(b, value);
+        }
+
+        /// Returns the hash kept up to date by every write.
+        [[nodiscard]] constexpr std::uint64_t hash() const noexcept {
+            return hash_;
+        }
+
+        /// Recomputes the hash from every cell, which should always equal `hash()`.
+        [[nodiscard]] std::uint64_t rehash() const noexcept {
+            std::uint64_t result = 0;
+            for (std::size_t y = 0; y < height(); ++y)
+                for (std::size_t x = 0; x < width(); ++x)
+                    result ^= keys_.key(y * width() + x, cells_.at(x, y));
+            return result;
+        }
+
+        [[nodiscard]] bool operator==(const zobrist_grid& rhs) const {
+            return hash_ == rhs.hash_ && cells_ == rhs.cells_;
+        }
+
+    private:
+        grid<T, Layout> cells_;
+        zobrist<T, Hash> keys_;
+        std::uint64_t hash_ = 0;
+    };
+}   // namespace aoc
+
+template <typename T, typename Layout, typename Hash>
+struct std::hash<aoc::zobrist_grid<T, Layout, Hash>> {
+    [[nodiscard]] std::size_t operator()(const aoc::zobrist_grid<T, Layout, Hash>& g) const noexcept {
+        return static_cast<std::size_t>(g.hash());
+    }
+};
+
+#endif  // ZOBRIST_HPP
@@ -0,0 +1,125 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "aoc.hpp"
+#include "doctest.h"
+
+using namespace aoc;
+
+namespace {
+    const auto field = grid<char>::from_lines(std::vector<std::string>{
+        "S.........#.........",
+        "..........#.........",
+        "..######..#..#####..",
+        ".......#.....#......",
+        ".......#######......",
+        "....................",
+        "..#################.",
+        "...................E",
+    });
+
+    const auto open = [](const pos<std::size_t>& p, auto&& emit) {
+        for (const auto& n : p.neighbours())
+            if (field.has(n) && field[n] != '#')
+                emit(n);
+    };
+
+    const auto unit = [](const pos<std::size_t>&, const pos<std::size_t>&) { return 1; };
+}
+
+TEST_CASE("astar") {
+    const pos<std::size_t> start{0};
+    const pos<std::size_t> goal{19, 7};
+    bfs reference{field.bounds()};
+    const auto expected = reference.search(start, goal, [](const pos<std::size_t>& p) { return field[p] != '#'; });
+
+    astar sut{field.bounds()};
+    CHECK_EQ(sut.search(start, goal, open, unit), expected);
+    const auto informed = sut.expanded();
+    CHECK_GT(sut.generated(), 0);
+
+    const auto path = sut.path(goal);
+    REQUIRE_EQ(path.size(), expected + 1);
+    CHECK_EQ(path.front(), start);
+    CHECK_EQ(path.back(), goal);
+
+    CHECK_EQ(sut.search(start, goal, open, unit, zero_heuristic{}), expected);
+    CHECK_LT(informed, sut.expanded());
+
+    CHECK_EQ(sut.search(start, pos<std::size_t>{10, 0}, open, unit), astar<>::unreachable);
+    CHECK_EQ(sut.search(start, pos<std::size_t>{30, 0}, open, unit), astar<>::unreachable);
+    CHECK_EQ(sut.search(start, start, open, unit), 0);
+    CHECK(sut.path(pos<std::size_t>{10, 0}).empty());
+}
+
+TEST_CASE("astar weighted") {
+    const auto weights = grid<char>::from_lines(std::vector<std::string>{
+        "1163751742",
+        "1381373672",
+        "2136511328",
+        "3694931569",
+        "7463417111",
+        "1319128137",
+        "1359912421",
+        "3125421639",
+        "1293138521",
+        "2311944581",
+    });
+    const auto all = [](const pos<int>& p, auto&& emit) {
+        for (const auto& n : p.neighbours())
+            emit(n);
+    };
+    const auto cost = [&weights](const pos<int>&, const pos<int>& to) { return weights[to] - '0'; };
+
+    astar<int, std::uint32_t> sut{area{9, 9}};
+    CHECK_EQ(sut.search(pos{0, 0}, pos{9, 9}, all, cost), 40);
+    CHECK_EQ(sut.search(pos{0, 0}, pos{9, 9}, all, cost, zero_heuristic{}), 40);
+
+    const auto diagonal = [](const pos<int>& p, auto&& emit) {
+        for (const auto& n : p.neighbours())
+            emit(n);
+        for (const auto& n : p.neighbours_diag())
+            emit(n);
+    };
+    const auto steps = [](const pos<int>&, const pos<int>&) { return 1; };
+    CHECK_EQ(sut.search(pos{0, 0}, pos{9, 5}, diagonal, steps, chebyshev_heuristic{}), 9);
+}
+
+TEST_CASE("hashed_astar") {
+    const pos<std::size_t> start{0};
+    const pos<std::size_t> goal{19, 7};
+    astar reference{field.bounds()};
+    const auto expected = reference.search(start, goal, open, unit);
+
+    hashed_astar<pos<std::size_t>> sut;
+    const auto atGoal = [&goal](const pos<std::size_t>& p) { return p == goal; };
+    const auto toGoal = [&goal](const pos<std::size_t>& p) { return p.manhattan(goal); };
+    CHECK_EQ(sut.search(start, atGoal, open, unit, toGoal), expected);
+    CHECK_EQ(sut.expanded(), reference.expanded());
+    const auto path = sut.path(goal);
+    REQUIRE_EQ(path.size(), expected + 1);
+    CHECK_EQ(path.front(), start);
+    CHECK_EQ(path.back(), goal);
+    CHECK_EQ(sut.search(start, [](const pos<std::size_t>& p) { return p == pos<std::size_t>{10, 0}; }, open, unit), hashed_astar<pos<std::size_t>>::unreachable);
+    CHECK(sut.path(pos<std::size_t>{10, 0}).empty());
+
+    // an unbounded plane with a wall along x = 5 from y = -20 to 20, which the path from the origin to (10, 0) has to go round
+    const auto plane = [](const pos<long long>& p, auto&& emit) {
+        for (const auto& n : p.neighbours())
+            if (n.x != 5 || n.y < -20 || n.y > 20)
+                emit(n);
+    };
+    const auto steps = [](const pos<long long>&, const pos<long long>&) { return 1; };
+    const pos<long long> target{10, 0};
+    const auto atTarget = [&target](const pos<long long>& p) { return p == target; };
+    hashed_astar<pos<long long>, std::uint32_t> unbounded;
+    CHECK_EQ(unbounded.search(pos<long long>{0}, atTarget, plane, steps, [&target](const pos<long long>& p) { return p.manhattan(target); }), 52);
+    const auto informed = unbounded.expanded();
+    const auto detour = unbounded.path(target);
+    REQUIRE_EQ(detour.size(), 53);
+    CHECK(std::ranges::any_of(detour, [](const pos<long long>& p) { return p.x == 5 && (p.y == 21 || p.y == -21); }));
+    CHECK_EQ(unbounded.search(pos<long long>{0}, atTarget, plane, steps), 52);
+    CHECK_LT(informed, unbounded.expanded());
+}
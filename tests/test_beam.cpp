@@ -0,0 +1,87 @@
+#include <cstddef>
+#include <random>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+#include "aoc.hpp"
+#include "doctest.h"
+
+using namespace aoc;
+
+namespace {
+    std::size_t naive(const grid<char>& g, const beam& start) {
+        std::set<std::tuple<std::size_t, std::size_t, direction>> seen;
+        std::set<std::pair<std::size_t, std::size_t>> lit;
+        std::vector<beam> stack{start};
+        while (!stack.empty()) {
+            const auto b = stack.back();
+            stack.pop_back();
+            if (b.at.x >= g.width() || b.at.y >= g.height() || !seen.emplace(b.at.x, b.at.y, b.heading).second)
+                continue;
+            lit.emplace(b.at.x, b.at.y);
+            const auto out = mirror_optics{}(g.at(b.at.x, b.at.y), b.heading);
+            if (out & direction_bit(direction::north))
+                stack.push_back(beam{pos<std::size_t>{b.at.x, b.at.y - 1}, direction::north});
+            if (out & direction_bit(direction::east))
+                stack.push_back(beam{pos<std::size_t>{b.at.x + 1, b.at.y}, direction::east});
+            if (out & direction_bit(direction::south))
+                stack.push_back(beam{pos<std::size_t>{b.at.x, b.at.y + 1}, direction::south});
+            if (out & direction_bit(direction::west))
+                stack.push_back(beam{pos<std::size_t>{b.at.x - 1, b.at.y}, direction::west});
+        }
+        return lit.size();
+    }
+}
+
+TEST_CASE("beam_tracer") {
+    const auto contraption = grid<char>::from_lines(std::vector<std::string>{
+        R"(.|...\....)",
+        R"(|.-.\.....)",
+        R"(.....|-...)",
+        R"(........|.)",
+        R"(..........)",
+        R"(.........\)",
+        R"(..../.\\..)",
+        R"(.-.-/..|..)",
+        R"(.|....-|.\)",
+        R"(..//.|....)",
+    });
+    beam_tracer tracer{contraption};
+    CHECK_EQ(tracer.width(), 10);
+    CHECK_EQ(tracer.height(), 10);
+    CHECK_FALSE(tracer.energised(0, 0));
+
+    CHECK_EQ(tracer.trace(beam{pos<std::size_t>{0, 0}, direction::east}), 46);
+    CHECK(tracer.energised(0, 0));
+    CHECK(tracer.energised(4, 6));
+    CHECK_FALSE(tracer.energised(9, 0));
+    CHECK_EQ(tracer.trace(beam{pos<std::size_t>{3, 0}, direction::south}), 51);
+
+    CHECK_EQ(tracer.edge_beams().size(), 40);
+    CHECK_EQ(tracer.max_energised(), 51);
+    CHECK_EQ(tracer.max_energised(4), 51);
+
+    const beam_tracer plain{grid<char>{3, 2, '.'}};
+    CHECK_EQ(plain.trace_all(std::vector<beam>{beam{pos<std::size_t>{2, 1}, direction::west}, beam{pos<std::size_t>{1, 1}, direction::north}}), std::vector<std::size_t>{3, 2});
+    CHECK_EQ(beam_tracer{grid<char>{}}.max_energised(), 0);
+}
+
+TEST_CASE("beam_tracer matches naive tracing") {
+    std::mt19937 rng{49};
+    for (const auto& [width, height] : {std::pair<std::size_t, std::size_t>{1, 1}, {7, 3}, {20, 20}, {33, 17}}) {
+        for (int round = 0; round < 5; ++round) {
+            grid<char> g{width, height};
+            for (auto& c : g)
+                c = rng() % 3 == 0 ? R"(/\|-)"[rng() % 4] : '.';
+            beam_tracer tracer{g};
+            const auto beams = tracer.edge_beams();
+            const auto counts = tracer.trace_all(beams, 3);
+            for (std::size_t i = 0; i < beams.size(); ++i) {
+                const auto expected = naive(g, beams[i]);
+                REQUIRE_EQ(counts[i], expected);
+                REQUIRE_EQ(tracer.trace(beams[i]), expected);
+            }
+        }
+    }
+}
@@ -0,0 +1,64 @@
+#include <ranges>
+#include <string>
+#include <vector>
+#include "aoc.hpp"
+#include "doctest.h"
+
+using namespace aoc;
+
+namespace {
+    const auto maze = grid<char>::from_lines(std::vector<std::string>{
+        "S..#....",
+        ".#.#.##.",
+        ".#...#..",
+        ".####.#.",
+        "......#E",
+    });
+}
+
+TEST_CASE("bfs run") {
+    bfs sut{maze.bounds()};
+    const auto open = [](const pos<std::size_t>& p) { return maze[p] != '#'; };
+    CHECK_EQ(sut.run(pos<std::size_t>{0}, open), 27);
+    CHECK_EQ(sut.distance(pos<std::size_t>{0}), 0);
+    CHECK_EQ(sut.distance(pos<std::size_t>{2, 2}), 4);
+    CHECK_EQ(sut.distance(pos<std::size_t>{7, 4}), 15);
+    CHECK_EQ(sut.distance(pos<std::size_t>{3, 0}), bfs<>::unreachable);
+    CHECK_FALSE(sut.reached(pos<std::size_t>{3, 0}));
+
+    const auto openIndex = [](std::size_t i) { return maze.data()[i] != '#'; };
+    const std::vector starts{pos<std::size_t>{0}, pos<std::size_t>{7, 4}};
+    CHECK_EQ(sut.run(starts, openIndex), 27);
+    CHECK_EQ(sut.distance(pos<std::size_t>{7, 0}), 4);
+    CHECK_EQ(sut.distance(pos<std::size_t>{0, 4}), 4);
+}
+
+TEST_CASE("bfs search") {
+    bfs sut{maze.bounds(), connectivity::four, true};
+    const auto open = [](const pos<std::size_t>& p) { return maze[p] != '#'; };
+    CHECK_EQ(sut.search(pos<std::size_t>{0}, pos<std::size_t>{7, 4}, open), 15);
+    const auto path = sut.path(pos<std::size_t>{7, 4});
+    REQUIRE_EQ(path.size(), 16);
+    CHECK_EQ(path.front(), pos<std::size_t>{0});
+    CHECK_EQ(path.back(), pos<std::size_t>{7, 4});
+    for (std::size_t i = 1; i < path.size(); ++i) {
+        const auto n = path[i - 1].neighbours();
+        CHECK_NE(std::ranges::find(n, path[i]), std::ranges::end(n));
+    }
+
+    CHECK_EQ(sut.search(pos<std::size_t>{0}, pos<std::size_t>{0}, open), 0);
+    CHECK_EQ(sut.search(pos<std::size_t>{0}, pos<std::size_t>{3, 0}, open), bfs<>::unreachable);
+    CHECK_EQ(sut.search(pos<std::size_t>{0}, pos<std::size_t>{8, 0}, open), bfs<>::unreachable);
+    CHECK(sut.path(pos<std::size_t>{3, 0}).empty());
+
+    bfs diag{maze.bounds(), connectivity::eight};
+    CHECK_EQ(diag.search(pos<std::size_t>{0}, pos<std::size_t>{7, 4}, open), 8);
+}
+
+TEST_CASE("bfs area") {
+    bfs sut{area{2, 2, -2, -2}};
+    CHECK_EQ(sut.run(pos{0, 0}, [](const pos<int>& p) { return p != pos{1, 0}; }), 24);
+    CHECK_EQ(sut.distance(pos{-2, -2}), 4);
+    CHECK_EQ(sut.distance(pos{2, 0}), 4);
+    CHECK_EQ(sut.distance(pos{1, 0}), bfs<int>::unreachable);
+}
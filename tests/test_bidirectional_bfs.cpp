@@ -0,0 +1,128 @@
+#include <cstdint>
+#include <random>
+#include <ranges>
+#include <string>
+#include <vector>
+#include "aoc.hpp"
+#include "doctest.h"
+
+using namespace aoc;
+
+namespace {
+    const auto maze = grid<char>::from_lines(std::vector<std::string>{
+        "S..#....",
+        ".#.#.##.",
+        ".#...#..",
+        ".####.#.",
+        "......#E",
+    });
+
+    template <typename T>
+    bool adjacent_steps(const std::vector<pos<T>>& path) {
+        for (std::size_t i = 1; i < path.size(); ++i) {
+            const auto n = path[i - 1].neighbours();
+            if (std::ranges::find(n, path[i]) == std::ranges::end(n))
+                return false;
+        }
+        return true;
+    }
+}
+
+TEST_CASE("bidirectional bfs search") {
+    bidirectional_bfs sut{maze.bounds()};
+    const auto open = [](const pos<std::size_t>& p) { return maze[p] != '#'; };
+    CHECK_EQ(sut.search(pos<std::size_t>{0}, pos<std::size_t>{7, 4}, open), 15);
+    const auto path = sut.path();
+    REQUIRE_EQ(path.size(), 16);
+    CHECK_EQ(path.front(), pos<std::size_t>{0});
+    CHECK_EQ(path.back(), pos<std::size_t>{7, 4});
+    CHECK(adjacent_steps(path));
+    CHECK(std::ranges::all_of(path, open));
+
+    const auto openIndex = [](std::size_t i) { return maze.data()[i] != '#'; };
+    CHECK_EQ(sut.search(pos<std::size_t>{7, 4}, pos<std::size_t>{0}, openIndex), 15);
+    CHECK_EQ(sut.path().front(), pos<std::size_t>{7, 4});
+    CHECK_EQ(sut.search(pos<std::size_t>{0}, pos<std::size_t>{2, 2}, open), 4);
+    CHECK_EQ(sut.path().size(), 5);
+
+    CHECK_EQ(sut.search(pos<std::size_t>{0}, pos<std::size_t>{0}, open), 0);
+    CHECK_EQ(sut.path(), std::vector{pos<std::size_t>{0}});
+    CHECK_EQ(sut.search(pos<std::size_t>{0}, pos<std::size_t>{1, 0}, open), 1);
+    CHECK_EQ(sut.path().size(), 2);
+}
+
+TEST_CASE("bidirectional bfs unreachable") {
+    bidirectional_bfs sut{maze.bounds()};
+    const auto open = [](const pos<std::size_t>& p) { return maze[p] != '#'; };
+    CHECK_EQ(sut.search(pos<std::size_t>{0}, pos<std::size_t>{3, 0}, open), bidirectional_bfs<>::unreachable);
+    CHECK(sut.path().empty());
+    CHECK_EQ(sut.search(pos<std::size_t>{0}, pos<std::size_t>{8, 0}, open), bidirectional_bfs<>::unreachable);
+    CHECK(sut.path().empty());
+}
+
+TEST_CASE("bidirectional bfs matches bfs") {
+    grid<char> g{40, 30, '.'};
+    std::mt19937 rng{7};
+    for (auto& c : g)
+        c = rng() % 10 < 3 ? '#' : '.';
+    const auto open = [&g](const pos<std::size_t>& p) { return g[p] != '#'; };
+    bfs reference{g.bounds()};
+    bidirectional_bfs sut{g.bounds()};
+    bidirectional_bfs diag{g.bounds(), connectivity::eight};
+    bfs diagReference{g.bounds(), connectivity::eight};
+    const pos<std::size_t> start{0};
+    g[start] = '.';
+    reference.run(start, open);
+    diagReference.run(start, open);
+    for (std::size_t y = 0; y < g.height(); y += 3) {
+        for (std::size_t x = 0; x < g.width(); x += 3) {
+            const pos<std::size_t> goal{x, y};
+            if (!open(goal))
+                continue;
+            CHECK_EQ(sut.search(start, goal, open), reference.distance(goal));
+            if (reference.reached(goal)) {
+                const auto path = sut.path();
+                CHECK_EQ(path.size(), reference.distance(goal) + 1);
+                CHECK(adjacent_steps(path));
+            }
+            CHECK_EQ(diag.search(start, goal, open), diagReference.distance(goal));
+        }
+    }
+}
+
+TEST_CASE("bidirectional bfs area") {
+    bidirectional_bfs sut{area{2, 2, -2, -2}};
+    const auto open = [](const pos<int>& p) { return p != pos{0, 0}; };
+    CHECK_EQ(sut.search(pos{-1, 0}, pos{1, 0}, open), 4);
+    CHECK_EQ(sut.path().size(), 5);
+}
+
+TEST_CASE("bidirectional search") {
+    // each move either doubles the value or adds one, and its reverse undoes it
+    const auto neighbours = [](int v, auto emit) {
+        if (v < 1000) {
+            emit(v + 1);
+            emit(v * 2);
+        }
+        if (v > 0)
+            emit(v - 1);
+        if (v % 2 == 0)
+            emit(v / 2);
+    };
+    const auto result = bidirectional_search(1, 100, neighbours);
+    CHECK_EQ(result.distance, 8);
+    REQUIRE_EQ(result.path.size(), 9);
+    CHECK_EQ(result.path.front(), 1);
+    CHECK_EQ(result.path.back(), 100);
+
+    CHECK_EQ(bidirectional_search(5, 5, neighbours).distance, 0);
+    CHECK_EQ(bidirectional_search(5, 5, neighbours).path, std::vector{5});
+
+    const auto none = bidirectional_search(pos{0, 0}, pos{5, 5}, [](const pos<int>& p, auto emit) {
+        for (const auto& n : p.neighbours())
+            if (n.x >= 0 && n.y >= 0 && n.x < 3 && n.y < 3)
+                emit(n);
+    });
+    CHECK_EQ(none.distance, std::numeric_limits<std::uint32_t>::max());
+    CHECK(none.path.empty());
+}
@@ -0,0 +1,41 @@
+#include "aoc.hpp"
+#include "doctest.h"
+
+using namespace aoc;
+
+TEST_CASE("bitset") {
+    bitset sut{130};
+    CHECK_EQ(sut.size(), 130);
+    CHECK_EQ(sut.words(), 3);
+    CHECK_EQ(sut.count(), 0);
+
+    sut.set(0);
+    sut.set(64);
+    sut.set(129);
+    CHECK(sut.test(0));
+    CHECK(sut.test(64));
+    CHECK(sut.test(129));
+    CHECK_FALSE(sut.test(1));
+    CHECK_EQ(sut.count(), 3);
+
+    CHECK(sut.test_and_set(64));
+    CHECK_FALSE(sut.test_and_set(65));
+    CHECK(sut.test(65));
+
+    sut.reset(0);
+    CHECK_FALSE(sut.test(0));
+    CHECK_EQ(sut.count(), 3);
+
+    sut.resize(65);
+    CHECK_EQ(sut.count(), 1);
+    sut.resize(200);
+    CHECK_FALSE(sut.test(129));
+
+    CHECK_FALSE(sut.atomic_test_and_set(3));
+    CHECK(sut.atomic_test_and_set(3));
+    CHECK(sut.atomic_test(3));
+    CHECK_FALSE(sut.atomic_test(4));
+
+    sut.clear();
+    CHECK_EQ(sut.count(), 0);
+}
@@ -0,0 +1,66 @@
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "aoc.hpp"
+#include "doctest.h"
+
+using namespace aoc;
+
+namespace {
+    std::pair<std::size_t, std::size_t> prices(const std::vector<std::string>& lines) {
+        const auto sut = label_components(grid<char>::from_lines(lines));
+        std::size_t byPerimeter = 0;
+        std::size_t bySides = 0;
+        for (const auto& r : sut.regions) {
+            byPerimeter += r.cells * r.perimeter;
+            bySides += r.cells * r.sides;
+        }
+        return {byPerimeter, bySides};
+    }
+}
+
+TEST_CASE("label_components") {
+    const auto g = grid<char>::from_lines(std::vector<std::string>{"AAAA", "BBCD", "BBCC", "EEEC"});
+    const auto sut = label_components(g);
+    REQUIRE_EQ(sut.regions.size(), 5);
+    CHECK_EQ(sut.labels.at(0, 0), 0);
+    CHECK_EQ(sut.labels.at(0, 1), 1);
+    CHECK_EQ(sut.labels.at(2, 1), 2);
+    CHECK_EQ(sut.labels.at(3, 3), 2);
+
+    const auto& c = sut.regions[2];
+    CHECK_EQ(c.cells, 4);
+    CHECK_EQ(c.perimeter, 10);
+    CHECK_EQ(c.sides, 8);
+    CHECK_EQ(c.bounds, area<std::size_t>{3, 3, 2, 1});
+    CHECK_EQ(c.seed, pos<std::size_t>{2, 1});
+    CHECK_EQ(g.at(c.seed), 'C');
+
+    CHECK_EQ(sut.regions[0].perimeter, 10);
+    CHECK_EQ(sut.regions[0].sides, 4);
+    CHECK_EQ(sut.regions[3].sides, 4);
+}
+
+TEST_CASE("label_components prices") {
+    CHECK_EQ(prices({"AAAA", "BBCD", "BBCC", "EEEC"}), std::pair<std::size_t, std::size_t>{140, 80});
+    CHECK_EQ(prices({"OOOOO", "OXOXO", "OOOOO", "OXOXO", "OOOOO"}), std::pair<std::size_t, std::size_t>{772, 436});
+    CHECK_EQ(prices({"EEEEE", "EXXXX", "EEEEE", "EXXXX", "EEEEE"}).second, 236);
+    CHECK_EQ(prices({"AAAAAA", "AAABBA", "AAABBA", "ABBAAA", "ABBAAA", "AAAAAA"}).second, 368);
+    CHECK_EQ(prices({
+        "RRRRIICCFF", "RRRRIICCCF", "VVRRRCCFFF", "VVRCCCJFFF", "VVVVCJJCFE",
+        "VVIVCCJJEE", "VVIIICJJEE", "MIIIIIJJEE", "MIIISIJEEE", "MMMISSJEEE",
+    }), std::pair<std::size_t, std::size_t>{1930, 1206});
+}
+
+TEST_CASE("label_components connectivity") {
+    const auto g = grid<char>::from_lines(std::vector<std::string>{"#..", ".#.", "..#", "#.."});
+    const auto isWall = [](char a, char b) { return (a == '#') == (b == '#'); };
+    CHECK_EQ(label_components(g, connectivity::four, isWall).regions.size(), 6);
+
+    const auto sut = label_components(g, connectivity::eight, isWall);
+    REQUIRE_EQ(sut.regions.size(), 3);
+    CHECK_EQ(sut.regions[0].cells, 3);
+    CHECK_EQ(sut.regions[0].bounds, area<std::size_t>{2, 2});
+    CHECK_EQ(sut.regions[1].cells, 8);
+    CHECK_EQ(sut.regions[2].cells, 1);
+}
@@ -0,0 +1,98 @@
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "aoc.hpp"
+#include "doctest.h"
+
+using namespace aoc;
+
+namespace {
+    constexpr auto next_value = [](std::uint32_t x) { return (x * x + 1) % 255; };
+
+    std::uint32_t brute_force(std::uint32_t x, std::size_t steps) {
+        for (std::size_t i = 0; i < steps; ++i)
+            x = next_value(x);
+        return x;
+    }
+}
+
+TEST_CASE("cycle info") {
+    const cycle_info sut{3, 4};
+    CHECK_EQ(sut.reduce(2), 2);
+    CHECK_EQ(sut.reduce(3), 3);
+    CHECK_EQ(sut.reduce(7), 3);
+    CHECK_EQ(sut.reduce(1000000001), 5);
+}
+
+TEST_CASE("find cycle") {
+    const auto sut = find_cycle(std::uint32_t{3}, next_value);
+    CHECK_GT(sut.length, 0);
+    CHECK_EQ(brute_force(3, sut.start), brute_force(3, sut.start + sut.length));
+    if (sut.start > 0)
+        CHECK_NE(brute_force(3, sut.start - 1), brute_force(3, sut.start - 1 + sut.length));
+    for (std::size_t length = 1; length < sut.length; ++length)
+        CHECK_NE(brute_force(3, sut.start), brute_force(3, sut.start + length));
+
+    CHECK_EQ(find_cycle(0, [](int x) { return x; }), cycle_info{0, 1});
+    CHECK_EQ(find_cycle(0, [](int x) { return x < 10 ? x + 1 : 5; }), cycle_info{5, 6});
+}
+
+TEST_CASE("simulate") {
+    for (const std::size_t steps : {0, 1, 5, 1000, 123457}) {
+        CHECK_EQ(simulate(std::uint32_t{3}, steps, next_value), brute_force(3, steps));
+        CHECK_EQ(simulate(std::uint32_t{3}, steps, next_value, cycle_memory::hashes), brute_force(3, steps));
+    }
+    CHECK_EQ(simulate(0, 1000000000, [](int x) { return x < 10 ? x + 1 : 5; }), 5 + (1000000000 - 5) % 6);
+    CHECK_EQ(simulate(0, 1000000000, [](int& x) { x = x < 10 ? x + 1 : 5; }, cycle_memory::hashes), 5 + (1000000000 - 5) % 6);
+}
+
+TEST_CASE("simulate grid") {
+    // a glider on an 8x8 torus is back where it started every 32 generations
+    grid<std::uint8_t> start{8, 8};
+    for (const auto& p : {pos{1, 0}, pos{2, 1}, pos{0, 2}, pos{1, 2}, pos{2, 2}})
+        start[p] = 1;
+    const auto generation = [](grid<std::uint8_t>& g) {
+        grid<std::uint8_t> next{g.width(), g.height()};
+        life_step(g, next, life_rule{}, border::wrap);
+        g = std::move(next);
+    };
+
+    auto expected = start;
+    for (int i = 0; i < 1000000007 % 32; ++i)
+        generation(expected);
+    CHECK_EQ(simulate(start, 1000000007, generation), expected);
+    CHECK_EQ(simulate(start, 1000000007, generation, cycle_memory::hashes), expected);
+    CHECK_EQ(simulate(start, 1000000000, generation), start);
+    CHECK_EQ(find_cycle(start, generation), cycle_info{0, 32});
+    CHECK_EQ(state_hash{}(start), state_hash{}(simulate(start, 32, generation)));
+
+    // cells of a tiled layout past the grid's edge are filled too, but do not take part in equality or hashing
+    tiled_grid<int> padded{5, 3};
+    padded.fill(7);
+    tiled_grid<int> clean{5, 3};
+    for (std::size_t y = 0; y < padded.height(); ++y)
+        for (std::size_t x = 0; x < padded.width(); ++x)
+            clean.at(x, y) = padded.at(x, y) = static_cast<int>(x * y);
+    REQUIRE_EQ(padded, clean);
+    CHECK_EQ(state_hash{}(padded), state_hash{}(clean));
+    grid<int> flat{5, 3};
+    for (std::size_t y = 0; y < flat.height(); ++y)
+        for (std::size_t x = 0; x < flat.width(); ++x)
+            flat.at(x, y) = static_cast<int>(x * y);
+    CHECK_EQ(state_hash{}(flat), state_hash{}(clean));
+}
+
+TEST_CASE("simulate positions") {
+    const auto move = [](std::vector<pos<int>> points) {
+        for (auto& p : points)
+            p = pos{(p.x * 3 + 1) % 7, (p.y + 2) % 5};
+        return points;
+    };
+    const std::vector start{pos{0, 0}, pos{3, 1}, pos{6, 4}};
+    auto expected = start;
+    for (int i = 0; i < 12345; ++i)
+        expected = move(expected);
+    CHECK_EQ(simulate(start, 12345, move), expected);
+    CHECK_EQ(simulate(start, 12345, move, cycle_memory::hashes), expected);
+    CHECK_NE(state_hash{}(start), state_hash{}(move(start)));
+}
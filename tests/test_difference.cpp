@@ -0,0 +1,59 @@
+#include <cstddef>
+#include <utility>
+#include "aoc.hpp"
+#include "doctest.h"
+
+using namespace aoc;
+
+TEST_CASE("difference_grid") {
+    difference_grid<int> sut{5, 4};
+    sut.add(area<std::size_t>{2, 2, 1, 1}, 3);
+    sut.add(area{10, 0, -3, -3}, 1);
+    sut.add(area{-1, 3, -5, 0}, 100);
+    sut.add(area<std::size_t>{4, 3, 4, 3}, -2);
+    const auto result = sut.materialize();
+    CHECK_EQ(result.at(0, 0), 1);
+    CHECK_EQ(result.at(4, 0), 1);
+    CHECK_EQ(result.at(0, 1), 0);
+    CHECK_EQ(result.at(1, 1), 3);
+    CHECK_EQ(result.at(2, 2), 3);
+    CHECK_EQ(result.at(3, 2), 0);
+    CHECK_EQ(result.at(4, 3), -2);
+
+    difference_grid<unsigned> toggles{3, 3};
+    toggles.toggle(area<std::size_t>{2, 2});
+    toggles.toggle(area<std::size_t>{1, 1});
+    const auto lights = toggles.materialize();
+    CHECK_EQ(lights.at(0, 0) % 2, 0);
+    CHECK_EQ(lights.at(2, 0) % 2, 1);
+    CHECK_EQ(lights.at(2, 2) % 2, 1);
+
+    for (const auto& [width, height] : {std::pair<std::size_t, std::size_t>{0, 0}, {0, 3}, {3, 0}}) {
+        difference_grid<int> empty{width, height};
+        empty.add(area<std::size_t>{5, 5}, 1);
+        empty.toggle(area{2, 2, -1, -1});
+        const auto cells = empty.materialize();
+        CHECK_EQ(cells.width(), width);
+        CHECK_EQ(cells.height(), height);
+    }
+}
+
+TEST_CASE("compressed_difference") {
+    compressed_difference<int> sut;
+    sut.add(area<long long>{999'999'999, 999'999'999, 0, 0}, 1);
+    sut.add(area<long long>{499'999'999, 999'999'999, 0, 500'000'000}, 1);
+    sut.toggle(area<long long>{-1, -1, -10, -10});
+    const auto result = sut.materialize();
+    CHECK_EQ(result.at(pos<long long>{0, 0}), 1);
+    CHECK_EQ(result.at(pos<long long>{0, 500'000'000}), 2);
+    CHECK_EQ(result.at(pos<long long>{500'000'000, 500'000'000}), 1);
+    CHECK_EQ(result.at(pos<long long>{1'000'000'000, 0}), 0);
+    CHECK_EQ(result.at(pos<long long>{-5, -5}), 1);
+    CHECK_EQ(result.at(pos<long long>{-11, -5}), 0);
+    CHECK_EQ(result.count_if([](int v) { return v > 0; }), 1'000'000'000'000'000'000LL + 100);
+    CHECK_EQ(result.count_if([](int v) { return v == 2; }), 250'000'000'000'000'000LL);
+
+    const auto empty = compressed_difference<int>{}.materialize();
+    CHECK_EQ(empty.at(pos<long long>{0}), 0);
+    CHECK_EQ(empty.count_if([](int) { return true; }), 0);
+}
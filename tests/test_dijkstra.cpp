@@ -0,0 +1,124 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+#include "aoc.hpp"
+#include "doctest.h"
+
+using namespace aoc;
+
+namespace {
+    const auto weights = grid<char>::from_lines(std::vector<std::string>{
+        "2413432311323",
+        "3215453535623",
+        "3255245654254",
+        "3446585845452",
+        "4546657867536",
+        "1438598798454",
+        "4457876987766",
+        "3637877979653",
+        "4654967986887",
+        "4564679986453",
+        "1224686865563",
+        "2546548887735",
+        "4322674655533",
+    });
+
+    const auto neighbours = [](const pos<std::size_t>& p, auto&& emit) {
+        for (const auto& n : p.neighbours())
+            if (weights.has(n))
+                emit(n, static_cast<std::uint64_t>(weights[n] - '0'));
+    };
+
+    constexpr std::array<pos<int>, 4> dirs{pos{1, 0}, pos{0, 1}, pos{-1, 0}, pos{0, -1}};
+
+    /// Direction-constrained state: at most three steps in a straight line.
+    struct crucible {
+        pos<std::size_t> at;
+        int dir;
+        int run;
+
+        bool operator==(const crucible&) const = default;
+    };
+
+    struct crucible_hash {
+        std::size_t operator()(const crucible& c) const noexcept {
+            return std::hash<pos<std::size_t>>{}(c.at) * 31 + static_cast<std::size_t>(c.dir * 4 + c.run);
+        }
+    };
+}
+
+TEST_CASE("queues") {
+    const std::vector<std::uint64_t> priorities{5, 3, 9, 3, 0, 7, 1, 8};
+    radix_heap<int> radix;
+    dary_heap<int> dary;
+    for (const auto p : priorities) {
+        radix.push(p, static_cast<int>(p));
+        dary.push(p, static_cast<int>(p));
+    }
+    std::uint64_t last = 0;
+    while (!radix.empty()) {
+        const auto [a, va] = radix.pop();
+        const auto [b, vb] = dary.pop();
+        CHECK_EQ(a, b);
+        CHECK_EQ(va, static_cast<int>(a));
+        CHECK_EQ(vb, static_cast<int>(b));
+        CHECK_LE(last, a);
+        last = a;
+    }
+    CHECK(dary.empty());
+
+    bucket_queue<char> bucket{3};
+    bucket.push(2, 'b');
+    bucket.push(0, 'a');
+    bucket.push(3, 'c');
+    CHECK_EQ(bucket.pop(), std::pair<std::uint64_t, char>{0, 'a'});
+    bucket.push(1, 'd');
+    CHECK_EQ(bucket.pop(), std::pair<std::uint64_t, char>{1, 'd'});
+    bucket.push(4, 'e');
+    CHECK_EQ(bucket.pop(), std::pair<std::uint64_t, char>{2, 'b'});
+    CHECK_EQ(bucket.pop(), std::pair<std::uint64_t, char>{3, 'c'});
+    CHECK_EQ(bucket.pop(), std::pair<std::uint64_t, char>{4, 'e'});
+    CHECK(bucket.empty());
+}
+
+TEST_CASE("dijkstra") {
+    const pos<std::size_t> goal{12, 12};
+    const auto isGoal = [&goal](const pos<std::size_t>& p) { return p == goal; };
+
+    dijkstra<pos<std::size_t>> sut1;
+    const auto expected = sut1.search(pos<std::size_t>{0}, neighbours, isGoal);
+    CHECK_EQ(expected, 78);
+    CHECK_EQ(sut1.distance(pos<std::size_t>{1, 0}), 4);
+
+    dijkstra<pos<std::size_t>, std::uint64_t, bucket_queue<pos<std::size_t>>> sut2{bucket_queue<pos<std::size_t>>{9}};
+    CHECK_EQ(sut2.search(pos<std::size_t>{0}, neighbours, isGoal), expected);
+    CHECK_EQ(sut2.search(pos<std::size_t>{0}, neighbours, isGoal), expected);
+
+    dijkstra<pos<std::size_t>, double> sut3;
+    const auto doubled = [](const pos<std::size_t>& p, auto&& emit) {
+        neighbours(p, [&emit](const pos<std::size_t>& n, std::uint64_t w) { emit(n, static_cast<double>(w) / 2); });
+    };
+    CHECK_EQ(sut3.search(pos<std::size_t>{0}, doubled, isGoal), doctest::Approx(static_cast<double>(expected) / 2));
+
+    sut1.run(std::vector{goal}, neighbours);
+    CHECK_EQ(sut1.distance(pos<std::size_t>{0}), expected - 3 + 2);
+    CHECK_EQ(sut1.distance(pos<std::size_t>{20, 0}), dijkstra<pos<std::size_t>>::unreachable);
+    CHECK_EQ(sut1.distances().size(), 13 * 13);
+}
+
+TEST_CASE("dijkstra custom state") {
+    dijkstra<crucible, std::uint64_t, default_queue_t<crucible, std::uint64_t>, crucible_hash> sut;
+    const auto cost = sut.search(std::vector{crucible{pos<std::size_t>{0}, 0, 0}, crucible{pos<std::size_t>{0}, 1, 0}}, [](const crucible& c, auto&& emit) {
+        for (int d = 0; d < 4; ++d) {
+            if (d == (c.dir + 2) % 4 || (d == c.dir && c.run == 3))
+                continue;
+            const auto next = c.at + dirs[static_cast<std::size_t>(d)];
+            if (weights.has(next))
+                emit(crucible{next, d, d == c.dir ? c.run + 1 : 1}, static_cast<std::uint64_t>(weights[next] - '0'));
+        }
+    }, [](const crucible& c) { return c.at == pos<std::size_t>{12, 12}; });
+    CHECK_EQ(cost, 102);
+}
@@ -0,0 +1,62 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "aoc.hpp"
+#include "doctest.h"
+
+using namespace aoc;
+
+namespace {
+    const auto map = grid<char>::from_lines(std::vector<std::string>{
+        "X.......#....",
+        "........#....",
+        ".....X..#..#.",
+        "........#..#.",
+        "...........#.",
+        "..X.......###",
+        ".............",
+    });
+
+    const auto isSource = [](char c) { return c == 'X'; };
+
+    std::uint32_t brute(const pos<std::size_t>& p, connectivity conn) {
+        auto best = infinite_distance;
+        for (std::size_t y = 0; y < map.height(); ++y)
+            for (std::size_t x = 0; x < map.width(); ++x)
+                if (isSource(map.at(x, y)))
+                    best = std::min(best, static_cast<std::uint32_t>(conn == connectivity::four ? p.manhattan(pos{x, y}) : p.chebyshev(pos{x, y})));
+        return best;
+    }
+}
+
+TEST_CASE("distance_transform") {
+    for (const auto conn : {connectivity::four, connectivity::eight}) {
+        for (const std::size_t threads : {1, 3, 64}) {
+            const auto sut = distance_transform(map, isSource, conn, threads);
+            for (std::size_t y = 0; y < map.height(); ++y)
+                for (std::size_t x = 0; x < map.width(); ++x)
+                    CHECK_EQ(sut.at(x, y), brute(pos{x, y}, conn));
+        }
+    }
+
+    const auto none = distance_transform(grid<char>{3, 2, '.'}, isSource);
+    CHECK(std::ranges::all_of(none, [](std::uint32_t d) { return d == infinite_distance; }));
+    CHECK(distance_transform(grid<char>{}, isSource).empty());
+}
+
+TEST_CASE("distance_field") {
+    const auto passable = [](char c) { return c != '#'; };
+    const auto sut1 = distance_field(map, isSource, passable);
+    CHECK_EQ(sut1.at(0, 0), 0);
+    CHECK_EQ(sut1.at(7, 0), 4);
+    CHECK_EQ(sut1.at(8, 0), infinite_distance);
+    CHECK_EQ(sut1.at(9, 0), 10);
+    CHECK_EQ(sut1.at(12, 0), 13);
+    CHECK_EQ(sut1.at(12, 4), 15);
+
+    const auto sut2 = distance_field(map, isSource, passable, connectivity::eight);
+    CHECK_EQ(sut2.at(12, 4), 9);
+    CHECK_EQ(sut2.at(0, 6), 2);
+}
@@ -0,0 +1,72 @@
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "aoc.hpp"
+#include "doctest.h"
+
+using namespace aoc;
+
+namespace {
+    const std::vector<std::string> lines{
+        "..........",
+        ".####.....",
+        ".#..#..##.",
+        ".#..#.#..#",
+        ".####.#..#",
+        "......####",
+        "##........",
+        ".#........",
+    };
+}
+
+TEST_CASE("flood_fill") {
+    auto g = grid<char>::from_lines(lines);
+    const auto sut1 = flood_fill(g, pos{2, 2}, 'o');
+    CHECK_EQ(sut1.filled, 4);
+    CHECK_EQ(sut1.bounds, area<std::size_t>{3, 3, 2, 2});
+    CHECK_EQ(g.at(3, 3), 'o');
+
+    const auto sut2 = flood_fill(g, pos{0, 0}, '~');
+    CHECK_EQ(sut2.filled, 80 - 4 - 12 - 10 - 4 - 3 - 1);
+    CHECK_EQ(sut2.bounds, area<std::size_t>{9, 7});
+    CHECK_EQ(g.at(7, 3), '.');
+    CHECK_EQ(g.at(0, 7), '.');
+
+    CHECK_EQ(flood_fill(g, pos{0, 0}, '~').filled, 0);
+    CHECK_EQ(flood_fill(g, pos{20, 0}, '~').filled, 0);
+}
+
+TEST_CASE("flood_fill predicate") {
+    auto g = tiled_grid<char>::from_lines(lines);
+    const auto empty = [](char c) { return c == '.'; };
+    const auto sut1 = flood_fill(g, pos{0, 7}, 'x', empty);
+    CHECK_EQ(sut1.filled, 1);
+
+    // the pocket at (7, 3) leaks out diagonally through (6, 2), but the box and the corner cell stay sealed
+    const auto sut2 = flood_fill(g, pos{7, 3}, 'x', empty, connectivity::eight);
+    CHECK_EQ(sut2.filled, 80 - 25 - 4 - 1);
+    CHECK_EQ(sut2.bounds, area<std::size_t>{9, 7});
+    CHECK_EQ(g, tiled_grid<char>::from_lines(std::vector<std::string>{
+        "xxxxxxxxxx",
+        "x####xxxxx",
+        "x#..#xx##x",
+        "x#..#x#xx#",
+        "x####x#xx#",
+        "xxxxxx####",
+        "##xxxxxxxx",
+        "x#xxxxxxxx",
+    }));
+
+    CHECK_THROWS_AS(flood_fill(g, pos{0, 0}, '.', empty), std::invalid_argument);
+}
+
+TEST_CASE("flood_fill large") {
+    grid<char> g{2000, 2000, '.'};
+    for (std::size_t y = 1; y < 2000; y += 2)
+        for (std::size_t x = (y / 2) % 2; x < 1999 + (y / 2) % 2; ++x)
+            g.at(x, y) = '#';
+    const auto sut = flood_fill(g, pos{0, 0}, 'o');
+    CHECK_EQ(sut.filled, static_cast<std::size_t>(std::ranges::count(g, 'o')));
+    CHECK_EQ(sut.filled, 1000 * 2000 + 1000);
+}
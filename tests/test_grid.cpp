@@ -0,0 +1,100 @@
+#include <set>
+#include <string>
+#include <vector>
+#include "aoc.hpp"
+#include "doctest.h"
+
+using namespace aoc;
+
+TEST_CASE("constructor") {
+    const grid<int> sut1{3, 2, 7};
+    CHECK_EQ(sut1.width(), 3);
+    CHECK_EQ(sut1.height(), 2);
+    CHECK_EQ(sut1.size(), 6);
+    CHECK_EQ(sut1.at(2, 1), 7);
+    CHECK_EQ(sut1.bounds(), area<std::size_t>{2, 1});
+
+    const grid<int> sut2;
+    CHECK(sut2.empty());
+    CHECK_THROWS_AS(static_cast<void>(sut2.bounds()), std::out_of_range);
+    CHECK_THROWS_AS(static_cast<void>(grid<int>(0, 3).bounds()), std::out_of_range);
+}
+
+TEST_CASE("from_lines") {
+    const std::vector<std::string> lines{"abc", "def"};
+    const auto sut1 = grid<char>::from_lines(lines);
+    CHECK_EQ(sut1.width(), 3);
+    CHECK_EQ(sut1.height(), 2);
+    CHECK_EQ(sut1[pos<>{0}], 'a');
+    CHECK_EQ(sut1[pos<>{1, 1}], 'e');
+
+    const auto sut2 = tiled_grid<char>::from_lines(lines);
+    CHECK_EQ(sut2[pos<>{2, 1}], 'f');
+
+    CHECK_THROWS_AS(static_cast<void>(grid<char>::from_lines(std::vector<std::string>{"ab", "c"})), std::invalid_argument);
+}
+
+TEST_CASE("has") {
+    const grid<char> sut{3, 2};
+    CHECK(sut.has(pos{0, 0}));
+    CHECK(sut.has(pos{2, 1}));
+    CHECK_FALSE(sut.has(pos{3, 1}));
+    CHECK_FALSE(sut.has(pos{2, 2}));
+    CHECK_FALSE(sut.has(pos{-1, 0}));
+    CHECK_FALSE(sut.has(pos{0, -1}));
+}
+
+TEST_CASE("at") {
+    grid<int> sut{4, 3};
+    sut.at(pos{1, 2}) = 5;
+    sut[pos<>{3, 0}] = 6;
+    CHECK_EQ(sut.at(1, 2), 5);
+    CHECK_EQ(sut.at(3, 0), 6);
+    CHECK_EQ(*(sut.begin() + 2 * 4 + 1), 5);
+}
+
+TEST_CASE("tiled") {
+    constexpr tiled<2> sut1{10, 5};
+    CHECK_EQ(sut1.size(), 3 * 2 * 16);
+    CHECK_EQ(sut1.index(0, 0), 0);
+    CHECK_EQ(sut1.index(3, 0), 3);
+    CHECK_EQ(sut1.index(0, 1), 4);
+    CHECK_EQ(sut1.index(4, 0), 16);
+    CHECK_EQ(sut1.index(0, 4), 48);
+
+    constexpr tiled<2, true> sut2{4, 4};
+    CHECK_EQ(sut2.index(1, 0), 1);
+    CHECK_EQ(sut2.index(0, 1), 2);
+    CHECK_EQ(sut2.index(1, 1), 3);
+    CHECK_EQ(sut2.index(2, 0), 4);
+    CHECK_EQ(sut2.index(3, 3), 15);
+}
+
+TEST_CASE("tiled grid") {
+    grid<int, tiled<2>> sut1{7, 5};
+    grid<int, tiled<3, true>> sut2{13, 11};
+    for (std::size_t y = 0; y < 5; ++y)
+        for (std::size_t x = 0; x < 7; ++x)
+            sut1.at(x, y) = static_cast<int>(y * 7 + x);
+
+    std::set<std::size_t> indices;
+    for (std::size_t y = 0; y < 11; ++y)
+        for (std::size_t x = 0; x < 13; ++x)
+            indices.insert(sut2.index(x, y));
+    CHECK_EQ(indices.size(), 13 * 11);
+
+    for (std::size_t y = 0; y < 5; ++y)
+        for (std::size_t x = 0; x < 7; ++x)
+            CHECK_EQ(sut1.at(x, y), static_cast<int>(y * 7 + x));
+}
+
+TEST_CASE("operator==") {
+    grid<int, tiled<2>> sut1{3, 3, 1};
+    grid<int, tiled<2>> sut2{3, 3};
+    CHECK_NE(sut1, sut2);
+    for (std::size_t y = 0; y < 3; ++y)
+        for (std::size_t x = 0; x < 3; ++x)
+            sut2.at(x, y) = 1;
+    CHECK_EQ(sut1, sut2);
+    CHECK_NE(grid<int>{3, 2}, grid<int>{2, 3});
+}
@@ -0,0 +1,150 @@
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "aoc.hpp"
+#include "doctest.h"
+
+using namespace aoc;
+
+namespace {
+    const std::vector glider{pos{1LL, 0LL}, pos{2LL, 1LL}, pos{0LL, 2LL}, pos{1LL, 2LL}, pos{2LL, 2LL}};
+
+    std::vector<pos<long long>> sorted(std::vector<pos<long long>> cells) {
+        std::ranges::sort(cells);
+        return cells;
+    }
+}
+
+TEST_CASE("hashlife set") {
+    hashlife sut;
+    CHECK_EQ(sut.population(), 0);
+    CHECK_EQ(sut.bounds(), area<long long>{0});
+    sut.set(pos{-100LL, 5LL});
+    sut.set(pos{3LL, 1000000LL});
+    CHECK(sut.test(pos{-100LL, 5LL}));
+    CHECK(sut.test(pos{3LL, 1000000LL}));
+    CHECK_FALSE(sut.test(pos{3LL, 999999LL}));
+    CHECK_FALSE(sut.test(pos{1LL << 40, 0LL}));
+    CHECK_EQ(sut.population(), 2);
+    CHECK_EQ(sut.bounds(), area<long long>{3, 1000000, -100, 5});
+    sut.set(pos{3LL, 1000000LL}, false);
+    CHECK_EQ(sut.population(), 1);
+    CHECK_EQ(sut.cells(), std::vector{pos{-100LL, 5LL}});
+    CHECK_THROWS_AS(hashlife{life_rule{"B0/S"}}, std::invalid_argument);
+}
+
+TEST_CASE("hashlife glider") {
+    auto sut = hashlife::from_cells(glider);
+    CHECK_EQ(sut.population(), 5);
+    sut.step(4);
+    CHECK_EQ(sut.bounds(), area<long long>{3, 3, 1, 1});
+
+    // a glider moves one cell diagonally every four generations, so 2^40 generations move it 2^38 cells
+    sut.step((std::uint64_t{1} << 40) - 4);
+    CHECK_EQ(sut.generation(), std::uint64_t{1} << 40);
+    CHECK_EQ(sut.population(), 5);
+    constexpr auto shift = 1LL << 38;
+    CHECK_EQ(sut.bounds(), area<long long>{shift + 2, shift + 2, shift, shift});
+    std::vector<pos<long long>> expected;
+    for (const auto& p : glider)
+        expected.push_back(pos{p.x + shift, p.y + shift});
+    CHECK_EQ(sorted(sut.cells()), sorted(expected));
+}
+
+TEST_CASE("hashlife coordinate limit") {
+    auto sut = hashlife::from_cells(glider);
+    CHECK_THROWS_AS(sut.step(std::uint64_t{1} << 61), std::out_of_range);
+    CHECK_EQ(sut.generation(), 0);
+
+    // four jumps of 2^60 generations carry the glider to 2^60, the last offset whose jump still fits below 2^61
+    for (int i = 0; i < 4; ++i)
+        sut.step(std::uint64_t{1} << 60);
+    CHECK_EQ(sut.generation(), std::uint64_t{1} << 62);
+    constexpr auto shift = 1LL << 60;
+    CHECK_EQ(sut.bounds(), area<long long>{shift + 2, shift + 2, shift, shift});
+    std::vector<pos<long long>> expected;
+    for (const auto& p : glider)
+        expected.push_back(pos{p.x + shift, p.y + shift});
+    CHECK_EQ(sorted(sut.cells()), sorted(expected));
+
+    CHECK_THROWS_AS(sut.step(std::uint64_t{1} << 60), std::out_of_range);
+    CHECK_EQ(sut.generation(), std::uint64_t{1} << 62);
+    CHECK_EQ(sorted(sut.cells()), sorted(expected));
+
+    hashlife edges;
+    edges.set(pos{-(1LL << 61), (1LL << 61) - 1});
+    CHECK(edges.test(pos{-(1LL << 61), (1LL << 61) - 1}));
+    CHECK_THROWS_AS(edges.set(pos{1LL << 61, 0LL}), std::out_of_range);
+}
+
+TEST_CASE("hashlife matches sparse life") {
+    std::mt19937 rng{11};
+    for (const auto& rule : {life_rule{}, life_rule{"B36/S23"}, life_rule{"B2/S"}}) {
+        sparse_life<long long> reference{rule};
+        std::vector<pos<long long>> cells;
+        for (long long y = -10; y < 10; ++y) {
+            for (long long x = -12; x < 12; ++x) {
+                if (rng() % 3 == 0) {
+                    cells.emplace_back(x, y);
+                    reference.set(pos{x, y});
+                }
+            }
+        }
+        auto sut = hashlife::from_cells(cells, rule);
+        for (const std::uint64_t steps : {1, 2, 3, 8, 13, 5}) {
+            sut.step(steps);
+            reference.step(steps);
+            std::vector<pos<long long>> expected;
+            reference.cells().for_each([&expected](const pos<long long>& p) { expected.push_back(p); });
+            CHECK_EQ(sorted(sut.cells()), sorted(expected));
+            CHECK_EQ(sut.bounds(), reference.bounds());
+        }
+    }
+}
+
+TEST_CASE("hashlife memory limit") {
+    std::vector<pos<long long>> cells;
+    for (long long x = 0; x < 30; x += 3)
+        cells.insert(cells.end(), {pos{x + 1, 0LL}, pos{x + 2, 1LL}, pos{x, 2LL}, pos{x + 1, 2LL}, pos{x + 2, 2LL}});
+    auto limited = hashlife::from_cells(cells, life_rule{}, 200);
+    auto unlimited = hashlife::from_cells(cells);
+    for (int i = 0; i < 20; ++i) {
+        limited.step(7);
+        unlimited.step(7);
+    }
+    CHECK_EQ(sorted(limited.cells()), sorted(unlimited.cells()));
+    CHECK_LT(limited.nodes(), unlimited.nodes());
+    unlimited.collect();
+    CHECK_EQ(sorted(limited.cells()), sorted(unlimited.cells()));
+    unlimited.step(100);
+    limited.step(100);
+    CHECK_EQ(limited.population(), unlimited.population());
+
+    // one long jump would need far more nodes than the limit, so it is split into shorter ones
+    auto split = hashlife::from_cells(cells, life_rule{}, 400);
+    auto whole = hashlife::from_cells(cells);
+    split.step(std::uint64_t{1} << 20);
+    whole.step(std::uint64_t{1} << 20);
+    CHECK_GT(whole.nodes(), 400);
+    CHECK_LE(split.nodes(), 400);
+    CHECK_EQ(split.generation(), whole.generation());
+    CHECK_EQ(sorted(split.cells()), sorted(whole.cells()));
+}
+
+TEST_CASE("hashlife grid") {
+    const auto g = grid<char>::from_lines(std::vector<std::string>{
+        ".#.",
+        "..#",
+        "###",
+    });
+    auto sut = hashlife::from_grid(g, [](char c) { return c == '#'; });
+    CHECK_EQ(sut.population(), 5);
+    CHECK_EQ(sut.to_grid(area<long long>{2, 2}, '#', '.'), g);
+    sut.step(8);
+    const auto moved = sut.to_grid(area<long long>{4, 4, 2, 2}, '#', '.');
+    CHECK_EQ(moved, g);
+    CHECK_EQ(sut.to_grid(area<long long>{1, 1}, 1, 0), grid<int>{2, 2, 0});
+}
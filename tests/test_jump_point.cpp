@@ -0,0 +1,108 @@
+#include <cstdint>
+#include <random>
+#include <ranges>
+#include <string>
+#include <vector>
+#include "aoc.hpp"
+#include "doctest.h"
+
+using namespace aoc;
+
+namespace {
+    const auto maze = grid<char>::from_lines(std::vector<std::string>{
+        "S..#....",
+        ".#.#.##.",
+        ".#...#..",
+        ".####.#.",
+        "......#E",
+    });
+
+    grid<char> random_grid(std::size_t width, std::size_t height, std::uint32_t seed, unsigned wallPercent) {
+        std::mt19937 rng{seed};
+        grid<char> result{width, height};
+        for (auto& c : result)
+            c = rng() % 100 < wallPercent ? '#' : '.';
+        return result;
+    }
+
+    template <typename T, typename Pass>
+    bool valid_path(const std::vector<pos<T>>& path, connectivity conn, Pass open) {
+        for (std::size_t i = 1; i < path.size(); ++i) {
+            const auto d = conn == connectivity::eight ? path[i - 1].chebyshev(path[i]) : path[i - 1].manhattan(path[i]);
+            if (d != 1 || !open(path[i]))
+                return false;
+        }
+        return true;
+    }
+}
+
+TEST_CASE("jump point search") {
+    const auto open = [](const pos<std::size_t>& p) { return maze[p] != '#'; };
+    jump_point_search sut{maze.bounds(), open};
+    CHECK_EQ(sut.search(pos<std::size_t>{0}, pos<std::size_t>{7, 4}), 15);
+    const auto path = sut.path();
+    REQUIRE_EQ(path.size(), 16);
+    CHECK_EQ(path.front(), pos<std::size_t>{0});
+    CHECK_EQ(path.back(), pos<std::size_t>{7, 4});
+    CHECK(valid_path(path, connectivity::four, open));
+    CHECK_LT(sut.jump_points().size(), path.size());
+    CHECK_EQ(sut.jump_points().front(), pos<std::size_t>{0});
+
+    CHECK_EQ(sut.search(pos<std::size_t>{0}, pos<std::size_t>{0}), 0);
+    CHECK_EQ(sut.path(), std::vector{pos<std::size_t>{0}});
+    CHECK_EQ(sut.search(pos<std::size_t>{0}, pos<std::size_t>{3, 0}), jump_point_search<>::unreachable);
+    CHECK(sut.path().empty());
+    CHECK_EQ(sut.search(pos<std::size_t>{0}, pos<std::size_t>{8, 0}), jump_point_search<>::unreachable);
+
+    jump_point_search diag{maze.bounds(), [](std::size_t i) { return maze.data()[i] != '#'; }, connectivity::eight};
+    CHECK_EQ(diag.search(pos<std::size_t>{0}, pos<std::size_t>{7, 4}), 8);
+    CHECK_EQ(diag.path().size(), 9);
+    CHECK(valid_path(diag.path(), connectivity::eight, open));
+}
+
+TEST_CASE("jump point search set passable") {
+    jump_point_search sut{area<std::size_t>{99, 0}, [](const pos<std::size_t>&) { return true; }};
+    CHECK_EQ(sut.search(pos<std::size_t>{0}, pos<std::size_t>{99, 0}), 99);
+    CHECK_EQ(sut.jump_points().size(), 2);
+    sut.set_passable(pos<std::size_t>{70, 0}, false);
+    CHECK_FALSE(sut.passable(pos<std::size_t>{70, 0}));
+    CHECK_EQ(sut.search(pos<std::size_t>{0}, pos<std::size_t>{99, 0}), jump_point_search<>::unreachable);
+    CHECK_EQ(sut.search(pos<std::size_t>{0}, pos<std::size_t>{69, 0}), 69);
+    sut.set_passable(pos<std::size_t>{70, 0}, true);
+    CHECK_EQ(sut.search(pos<std::size_t>{99, 0}, pos<std::size_t>{0}), 99);
+}
+
+TEST_CASE("jump point search area") {
+    jump_point_search sut{area{2, 2, -2, -2}, [](const pos<int>& p) { return p != pos{0, 0}; }};
+    CHECK_EQ(sut.search(pos{-1, 0}, pos{1, 0}), 4);
+    CHECK_EQ(sut.path().size(), 5);
+    jump_point_search diag{area{2, 2, -2, -2}, [](const pos<int>& p) { return p != pos{0, 0}; }, connectivity::eight};
+    CHECK_EQ(diag.search(pos{-1, 0}, pos{1, 0}), 2);
+    CHECK_EQ(diag.search(pos{-2, -2}, pos{2, 2}), 5);
+}
+
+TEST_CASE("jump point search matches bfs") {
+    for (const auto conn : {connectivity::four, connectivity::eight}) {
+        for (const unsigned walls : {0U, 10U, 25U, 40U}) {
+            const auto g = random_grid(150, 37, walls + 1, walls);
+            const auto open = [&g](const pos<std::size_t>& p) { return g[p] != '#'; };
+            jump_point_search sut{g.bounds(), open, conn};
+            bfs reference{g.bounds(), conn};
+            for (const auto& start : {pos<std::size_t>{0}, pos<std::size_t>{75, 18}, pos<std::size_t>{149, 36}}) {
+                reference.run(start, open);
+                for (std::size_t y = 0; y < g.height(); y += 4) {
+                    for (std::size_t x = 0; x < g.width(); x += 7) {
+                        const pos<std::size_t> goal{x, y};
+                        const auto expected = goal == start || open(goal) ? reference.distance(goal) : bfs<>::unreachable;
+                        CHECK_EQ(sut.search(start, goal), expected);
+                        if (expected != bfs<>::unreachable) {
+                            const auto path = sut.path();
+                            CHECK_EQ(path.size(), expected + 1);
+                            CHECK(valid_path(path, conn, open));
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,112 @@
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "aoc.hpp"
+#include "doctest.h"
+
+using namespace aoc;
+
+namespace {
+    const auto trails = grid<char>::from_lines(std::vector<std::string>{
+        "#.#####################",
+        "#.......#########...###",
+        "#######.#########.#.###",
+        "###.....#.>.>.###.#.###",
+        "###v#####.#v#.###.#.###",
+        "###.>...#.#.#.....#...#",
+        "###v###.#.#.#########.#",
+        "###...#.#.#.......#...#",
+        "#####.#.#.#######.#.###",
+        "#.....#.#.#.......#...#",
+        "#.#####.#.#.#########v#",
+        "#.#...#...#...###...>.#",
+        "#.#.#v#######v###.###v#",
+        "#...#.>.#...>.>.#.###.#",
+        "#####v#.#.###v#.#.###.#",
+        "#.....#...#...#.#.#...#",
+        "#.#########.###.#.#.###",
+        "#...###...#...#...#.###",
+        "###.###.#.###v#####v###",
+        "#...#...#.#.>.>.#.>.###",
+        "#.###.###.#.###.#.#v###",
+        "#.....###...###...#...#",
+        "#####################.#",
+    });
+
+    const pos<std::size_t> start{1, 0};
+    const pos<std::size_t> goal{21, 22};
+    const auto open = [](const pos<std::size_t>& p) { return trails[p] != '#'; };
+    const auto ends = [](const pos<std::size_t>& p) { return p == start || p == goal; };
+}
+
+TEST_CASE("contract corridors") {
+    const auto sut = contract_corridors(trails.bounds(), open, ends);
+    CHECK_EQ(sut.graph.nodes(), 9);
+    CHECK_EQ(sut.positions.size(), 9);
+    CHECK_EQ(sut.graph.edges(), 24);
+    REQUIRE_NE(sut.node(start), junction_graph<>::npos);
+    REQUIRE_NE(sut.node(goal), junction_graph<>::npos);
+    CHECK_EQ(sut.positions[sut.node(goal)], goal);
+    CHECK_EQ(sut.node(pos<std::size_t>{2, 1}), junction_graph<>::npos);
+    CHECK_EQ(sut.node(pos<std::size_t>{0}), junction_graph<>::npos);
+
+    std::size_t degree = 0;
+    std::uint32_t weight = 0;
+    sut.graph.for_each_edge(sut.node(start), [&](std::uint32_t next, std::uint32_t w) {
+        ++degree;
+        weight = w;
+        CHECK_EQ(sut.positions[next], pos<std::size_t>{3, 5});
+    });
+    CHECK_EQ(degree, 1);
+    CHECK_EQ(weight, 15);
+
+    const auto indexed = contract_corridors(trails.bounds(), [](std::size_t i) { return trails.data()[i] != '#'; }, ends);
+    CHECK_EQ(indexed.graph.offsets, sut.graph.offsets);
+    CHECK_EQ(indexed.graph.targets, sut.graph.targets);
+    CHECK_EQ(indexed.graph.weights, sut.graph.weights);
+}
+
+TEST_CASE("contract corridors without ends") {
+    // the start and goal are dead ends, so they become nodes anyway
+    const auto sut = contract_corridors(trails.bounds(), open);
+    CHECK_EQ(sut.graph.nodes(), 9);
+
+    const auto loop = contract_corridors(area<std::size_t>{2, 2}, [](const pos<std::size_t>& p) { return p != pos<std::size_t>{1, 1}; });
+    CHECK_EQ(loop.graph.nodes(), 0);
+    const auto kept = contract_corridors(area<std::size_t>{2, 2}, [](const pos<std::size_t>& p) { return p != pos<std::size_t>{1, 1}; },
+        [](const pos<std::size_t>& p) { return p == pos<std::size_t>{0, 0}; });
+    REQUIRE_EQ(kept.graph.nodes(), 1);
+    CHECK_EQ(kept.graph.edges(), 0);
+}
+
+TEST_CASE("all pairs distances") {
+    const auto sut = contract_corridors(trails.bounds(), open, ends);
+    const auto distances = all_pairs_distances(sut.graph);
+    REQUIRE_EQ(distances.width(), sut.graph.nodes());
+    bfs reference{trails.bounds()};
+    for (std::uint32_t s = 0; s < sut.graph.nodes(); ++s) {
+        reference.run(sut.positions[s], open);
+        for (std::uint32_t t = 0; t < sut.graph.nodes(); ++t)
+            CHECK_EQ(distances.at(t, s), reference.distance(sut.positions[t]));
+    }
+
+    dijkstra<std::uint32_t> search;
+    const auto neighbours = [&sut](std::uint32_t node, auto emit) { sut.graph.for_each_edge(node, emit); };
+    const auto goalNode = sut.node(goal);
+    CHECK_EQ(search.search(sut.node(start), neighbours, [goalNode](std::uint32_t node) { return node == goalNode; }), distances.at(goalNode, sut.node(start)));
+
+    csr_graph<std::uint32_t> split{{0, 1, 1}, {1}, {5}};
+    const auto oneWay = all_pairs_distances(split);
+    CHECK_EQ(oneWay.at(1, 0), 5);
+    CHECK_EQ(oneWay.at(0, 1), std::numeric_limits<std::uint32_t>::max());
+}
+
+TEST_CASE("longest path") {
+    const auto sut = contract_corridors(trails.bounds(), open, ends);
+    CHECK_EQ(longest_path(sut.graph, sut.node(start), sut.node(goal)), 154);
+    CHECK_EQ(longest_path(sut.graph, sut.node(start), sut.node(start)), 0);
+    CHECK_THROWS_AS(static_cast<void>(longest_path(sut.graph, 0, 100)), std::out_of_range);
+
+    csr_graph<std::uint32_t> split{{0, 0, 0}, {}, {}};
+    CHECK_EQ(longest_path(split, 0, 1), std::numeric_limits<std::uint32_t>::max());
+}
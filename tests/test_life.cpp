@@ -0,0 +1,212 @@
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include "aoc.hpp"
+#include "doctest.h"
+
+using namespace aoc;
+
+namespace {
+    const auto lights = grid<char>::from_lines(std::vector<std::string>{
+        ".#.#.#",
+        "...##.",
+        "#....#",
+        "..#...",
+        "#.#..#",
+        "####..",
+    });
+
+    /// Steps a grid one cell at a time, as a reference for the fast paths.
+    grid<std::uint8_t> naive_step(const grid<std::uint8_t>& g, const life_rule& rule, border edge) {
+        grid<std::uint8_t> result{g.width(), g.height()};
+        const auto w = static_cast<long long>(g.width());
+        const auto h = static_cast<long long>(g.height());
+        for (long long y = 0; y < h; ++y) {
+            for (long long x = 0; x < w; ++x) {
+                unsigned count = 0;
+                for (long long dy = -1; dy <= 1; ++dy) {
+                    for (long long dx = -1; dx <= 1; ++dx) {
+                        if (dx == 0 && dy == 0)
+                            continue;
+                        auto nx = x + dx;
+                        auto ny = y + dy;
+                        if (edge == border::wrap) {
+                            nx = (nx + w) % w;
+                            ny = (ny + h) % h;
+                        } else if (nx < 0 || ny < 0 || nx >= w || ny >= h) {
+                            continue;
+                        }
+                        count += g.at(static_cast<std::size_t>(nx), static_cast<std::size_t>(ny));
+                    }
+                }
+                const auto alive = g.at(static_cast<std::size_t>(x), static_cast<std::size_t>(y));
+                const bool frozen = edge == border::fixed && (x == 0 || y == 0 || x == w - 1 || y == h - 1);
+                result.at(static_cast<std::size_t>(x), static_cast<std::size_t>(y)) = frozen ? alive : rule.next(alive, count);
+            }
+        }
+        return result;
+    }
+}
+
+TEST_CASE("life rule") {
+    const life_rule conway;
+    CHECK_EQ(conway.birth(), 0b1000);
+    CHECK_EQ(conway.survival(), 0b1100);
+    CHECK(conway.next(false, 3));
+    CHECK_FALSE(conway.next(false, 2));
+    CHECK(conway.next(true, 2));
+    CHECK_FALSE(conway.next(true, 4));
+
+    const life_rule highLife{"s23/b36"};
+    CHECK_EQ(highLife.birth(), 0b1001000);
+    CHECK_EQ(highLife.survival(), 0b1100);
+    CHECK_EQ(life_rule{"B/S"}.birth(), 0);
+    CHECK_EQ(life_rule{"B012345678/S012345678"}.survival(), 0x1FF);
+
+    CHECK_THROWS_AS(life_rule{"B3"}, std::invalid_argument);
+    CHECK_THROWS_AS(life_rule{"B9/S23"}, std::invalid_argument);
+    CHECK_THROWS_AS(life_rule{"3/23"}, std::invalid_argument);
+    CHECK_THROWS_AS(life_rule{"B3/S23/B3"}, std::invalid_argument);
+    CHECK_THROWS_AS(life_rule{"B3,S23"}, std::invalid_argument);
+}
+
+TEST_CASE("life step") {
+    auto sut = life::from_grid(lights, [](char c) { return c == '#'; });
+    CHECK_EQ(sut.width(), 6);
+    CHECK_EQ(sut.height(), 6);
+    CHECK_EQ(sut.population(), 15);
+    sut.step();
+    CHECK_EQ(sut.population(), 11);
+    sut.step(3);
+    CHECK_EQ(sut.population(), 4);
+    CHECK(sut.test(pos{2, 2}));
+    CHECK(sut.test(3, 2));
+    CHECK_FALSE(sut.test(0, 0));
+
+    sut.set(pos{0, 0});
+    CHECK(sut.test(0, 0));
+    sut.set(0, 0, false);
+    CHECK_EQ(sut.population(), 4);
+}
+
+TEST_CASE("life borders") {
+    // a glider crossing a torus comes back to where it started
+    life sut{70, 5, life_rule{}, border::wrap};
+    for (const auto& p : {pos{1, 0}, pos{2, 1}, pos{0, 2}, pos{1, 2}, pos{2, 2}})
+        sut.set(p);
+    sut.step(4 * 70 * 5);
+    CHECK_EQ(sut.population(), 5);
+    for (const auto& p : {pos{1, 0}, pos{2, 1}, pos{0, 2}, pos{1, 2}, pos{2, 2}})
+        CHECK(sut.test(p));
+
+    life fixed{3, 3, life_rule{}, border::fixed};
+    fixed.set(0, 0);
+    fixed.set(1, 0);
+    fixed.set(2, 0);
+    fixed.step(5);
+    CHECK_EQ(fixed.population(), 4);
+    CHECK(fixed.test(1, 1));
+
+    life empty{0, 0};
+    empty.step();
+    CHECK_EQ(empty.population(), 0);
+}
+
+TEST_CASE("life matches naive") {
+    std::mt19937 rng{99};
+    for (const auto& rule : {life_rule{}, life_rule{"B36/S23"}, life_rule{"B2/S"}, life_rule{"B0/S8"}}) {
+        for (const auto edge : {border::dead, border::fixed, border::wrap}) {
+            for (const std::size_t width : {1, 2, 63, 64, 65, 130}) {
+                grid<std::uint8_t> g{width, 7};
+                for (auto& c : g)
+                    c = rng() % 3 == 0;
+                auto sut = life::from_grid(g, [](std::uint8_t c) { return c != 0; }, rule, edge);
+                grid<std::uint8_t> bytes = g;
+                grid<std::uint8_t> back{width, 7};
+                for (int generation = 0; generation < 6; ++generation) {
+                    g = naive_step(g, rule, edge);
+                    sut.step();
+                    life_step(bytes, back, rule, edge);
+                    std::swap(bytes, back);
+                    CHECK_EQ(bytes, g);
+                    bool same = true;
+                    for (std::size_t y = 0; y < g.height(); ++y)
+                        for (std::size_t x = 0; x < g.width(); ++x)
+                            same = same && sut.test(x, y) == (g.at(x, y) != 0);
+                    CHECK(same);
+                }
+            }
+        }
+    }
+
+    const grid<std::uint8_t> small{2, 2};
+    grid<std::uint8_t> wide{3, 2};
+    CHECK_THROWS_AS(life_step(small, wide, life_rule{}), std::invalid_argument);
+}
+
+TEST_CASE("life threads") {
+    std::mt19937 rng{5};
+    grid<std::uint8_t> g{200, 97};
+    for (auto& c : g)
+        c = rng() % 3 == 0;
+    for (const auto edge : {border::dead, border::fixed, border::wrap}) {
+        auto single = life::from_grid(g, [](std::uint8_t c) { return c != 0; }, life_rule{}, edge);
+        auto banded = single;
+        auto stepped = single;
+        CHECK(single.step(25));
+        CHECK(banded.step(25, 4));
+        for (int i = 0; i < 25; ++i)
+            CHECK(stepped.step(1, i < 20 ? 4 : 3));
+        auto moved = std::move(stepped);
+        CHECK_EQ(banded.population(), single.population());
+        CHECK_EQ(moved.population(), single.population());
+        bool same = true;
+        for (std::size_t y = 0; y < g.height(); ++y)
+            for (std::size_t x = 0; x < g.width(); ++x)
+                same = same && banded.test(x, y) == single.test(x, y) && moved.test(x, y) == single.test(x, y);
+        CHECK(same);
+        CHECK_EQ(moved.step(3, 4), single.step(3));
+        CHECK_EQ(moved.population(), single.population());
+    }
+
+    life tiny{4, 2};
+    tiny.set(0, 0);
+    CHECK(tiny.step(1, 8));
+    CHECK_EQ(tiny.population(), 0);
+}
+
+TEST_CASE("life changed") {
+    for (const std::size_t threads : {1, 3}) {
+        life block{6, 6};
+        for (const auto& p : {pos{1, 1}, pos{2, 1}, pos{1, 2}, pos{2, 2}})
+            block.set(p);
+        CHECK_FALSE(block.step(1, threads));
+        CHECK_FALSE(block.step(1000000000, threads));
+        CHECK_EQ(block.population(), 4);
+
+        life blinker{5, 5};
+        for (const auto& p : {pos{1, 2}, pos{2, 2}, pos{3, 2}})
+            blinker.set(p);
+        CHECK(blinker.step(3, threads));
+        CHECK(blinker.test(2, 1));
+        CHECK(blinker.test(2, 3));
+        CHECK_FALSE(blinker.step(0, threads));
+
+        // a lone pair dies in one step, then nothing changes
+        life pair{5, 5};
+        pair.set(1, 1);
+        pair.set(2, 1);
+        CHECK_FALSE(pair.step(1000000000, threads));
+        CHECK_EQ(pair.population(), 0);
+    }
+
+    grid<std::uint8_t> still{4, 4};
+    for (const auto& p : {pos{1, 1}, pos{2, 1}, pos{1, 2}, pos{2, 2}})
+        still[p] = 1;
+    grid<std::uint8_t> next{4, 4};
+    CHECK_FALSE(life_step(still, next, life_rule{}));
+    still[pos{0, 0}] = 1;
+    CHECK(life_step(still, next, life_rule{}));
+}
@@ -0,0 +1,68 @@
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include "aoc.hpp"
+#include "doctest.h"
+
+using namespace aoc;
+
+namespace {
+    grid<char> random_maze(std::size_t width, std::size_t height, unsigned wallPercent) {
+        grid<char> result{width, height, '.'};
+        std::mt19937 rng{12345};
+        for (std::size_t y = 0; y < height; ++y)
+            for (std::size_t x = 0; x < width; ++x)
+                if (rng() % 100 < wallPercent)
+                    result.at(x, y) = '#';
+        result.at(0, 0) = '.';
+        return result;
+    }
+}
+
+TEST_CASE("parallel_bfs") {
+    for (const unsigned walls : {0U, 25U}) {
+        const auto maze = random_maze(157, 91, walls);
+        const auto open = [&maze](const pos<std::size_t>& p) { return maze[p] != '#'; };
+        for (const auto conn : {connectivity::four, connectivity::eight}) {
+            bfs reference{maze.bounds(), conn};
+            const std::vector starts{pos<std::size_t>{0}, pos<std::size_t>{80, 45}};
+            const auto expected = reference.run(starts, open);
+            for (const std::size_t threads : {1, 2, 4}) {
+                parallel_bfs sut{maze.bounds(), threads, conn};
+                CHECK_EQ(sut.run(starts, open), expected);
+                for (std::size_t y = 0; y < maze.height(); ++y)
+                    for (std::size_t x = 0; x < maze.width(); ++x)
+                        REQUIRE_EQ(sut.distance(pos{x, y}), reference.distance(pos{x, y}));
+            }
+        }
+    }
+}
+
+TEST_CASE("parallel_bfs bottom_up") {
+    const auto maze = random_maze(64, 64, 0);
+    std::vector<pos<std::size_t>> starts;
+    for (std::size_t x = 0; x < 64; x += 2)
+        starts.emplace_back(x, 0);
+    parallel_bfs sut{maze.bounds(), 3};
+    CHECK_EQ(sut.run(starts, [](std::size_t) { return true; }), 64 * 64);
+    CHECK_GT(sut.bottom_up_levels(), 0);
+    CHECK_EQ(sut.distance(pos<std::size_t>{1, 63}), 64);
+    CHECK_EQ(sut.distance(pos<std::size_t>{64, 0}), parallel_bfs<>::unreachable);
+    CHECK_EQ(sut.run(pos<std::size_t>{100, 100}, [](std::size_t) { return true; }), 0);
+}
+
+TEST_CASE("parallel_bfs exception") {
+    const auto maze = random_maze(100, 100, 0);
+    for (const std::size_t threads : {1, 4}) {
+        parallel_bfs sut{maze.bounds(), threads};
+        const auto blocked = [](const pos<std::size_t>& p) {
+            if (p == pos<std::size_t>{50, 50})
+                throw std::runtime_error{"blocked"};
+            return true;
+        };
+        CHECK_THROWS_AS(sut.run(pos<std::size_t>{0}, blocked), std::runtime_error);
+        CHECK_EQ(sut.run(pos<std::size_t>{0}, [](std::size_t) { return true; }), 100 * 100);
+        CHECK_EQ(sut.distance(pos<std::size_t>{50, 50}), 100);
+    }
+}
@@ -0,0 +1,96 @@
+#include <array>
+#include <cstddef>
+#include <random>
+#include <vector>
+#include "aoc.hpp"
+#include "doctest.h"
+
+using namespace aoc;
+
+namespace {
+    particles<int> robots() {
+        const std::vector<std::array<int, 4>> input{
+            {0, 4, 3, -3}, {6, 3, -1, -3}, {10, 3, -1, 2}, {2, 0, 2, -1}, {0, 0, 1, 3}, {3, 0, -2, -2},
+            {7, 6, -1, -3}, {3, 0, -1, -2}, {9, 3, 2, 3}, {7, 3, -1, 2}, {2, 4, 2, -3}, {9, 5, -3, -3},
+        };
+        particles<int> result{area<int>{10, 6}};
+        result.reserve(input.size());
+        for (const auto& [px, py, vx, vy] : input)
+            result.add(pos<int>{px, py}, pos<int>{vx, vy});
+        return result;
+    }
+}
+
+TEST_CASE("particles") {
+    auto system = robots();
+    CHECK_EQ(system.size(), 12);
+    CHECK_EQ(system.position(0), pos<int>{0, 4});
+    CHECK_EQ(system.reduced_velocity(0), pos<int>{3, 4});
+
+    system.step(100);
+    CHECK_EQ(system.time(), 100);
+    CHECK_EQ(system.quadrants(), std::array<std::size_t, 4>{1, 3, 4, 1});
+
+    auto stepped = robots();
+    for (int i = 0; i < 100; ++i)
+        stepped.step();
+    for (std::size_t i = 0; i < system.size(); ++i)
+        CHECK_EQ(stepped.position(i), system.position(i));
+
+    system.step(-100);
+    CHECK_EQ(system.time(), 0);
+    CHECK_EQ(system.position(11), pos<int>{9, 5});
+
+    particles<int> single{area<int>{3, 3}};
+    single.add(pos<int>{2, 1}, pos<int>{1, 1});
+    single.step();
+    CHECK_EQ(single.position(0), pos<int>{3, 2});
+    single.step();
+    CHECK_EQ(single.position(0), pos<int>{0, 3});
+    CHECK_EQ(single.quadrants(), std::array<std::size_t, 4>{0, 0, 1, 0});
+}
+
+TEST_CASE("particles bounds and variance") {
+    particles<long long> system{area<long long>{4, 4, -5, -5}};
+    CHECK_EQ(system.bounds(), area<long long>{-5, -5, -5, -5});
+    CHECK_EQ(system.variance(), pos<double>{0, 0});
+
+    system.add(pos<long long>{-6, 0}, pos<long long>{0, 0});
+    system.add(pos<long long>{2, 3}, pos<long long>{0, 0});
+    CHECK_EQ(system.position(0), pos<long long>{4, 0});
+    CHECK_EQ(system.bounds(), area<long long>{4, 3, 2, 0});
+    CHECK_EQ(system.variance(), pos<double>{1, 2.25});
+
+    particles<int> clustered{area<int>{100, 102}};
+    for (int i = 0; i < 50; ++i)
+        clustered.add(pos<int>{i * 7, i * 14}, pos<int>{-i, -2 * i});
+    CHECK_GT(clustered.variance().x, 100);
+    clustered.step(7);
+    CHECK_EQ(clustered.variance(), pos<double>{0, 0});
+    CHECK_EQ(clustered.bounds(), area<int>{0});
+}
+
+TEST_CASE("particles jump") {
+    std::mt19937 rng{48};
+    for (const int size : {7, 101, 70000, 2'000'000'000}) {
+        particles<int> system{area<int>{size - 1, 102}};
+        std::vector<pos<long long>> positions;
+        std::vector<pos<long long>> velocities;
+        for (int i = 0; i < 200; ++i) {
+            const pos<int> p{static_cast<int>(rng() % static_cast<unsigned>(size)), static_cast<int>(rng() % 103)};
+            const pos<int> v{static_cast<int>(rng() % 2001) - 1000, static_cast<int>(rng() % 2001) - 1000};
+            system.add(p, v);
+            positions.push_back(pos<long long>{p.x, p.y});
+            velocities.push_back(pos<long long>{v.x, v.y});
+        }
+        for (const long long steps : {1LL, 0LL, 5LL, -3LL, 123'456'789'012LL, -98'765LL}) {
+            system.step(steps);
+            for (std::size_t i = 0; i < system.size(); ++i) {
+                auto& p = positions[i];
+                p.x = ((p.x + velocities[i].x * steps) % size + size) % size;
+                p.y = ((p.y + velocities[i].y * steps) % 103 + 103) % 103;
+                REQUIRE_EQ(system.position(i), pos<int>{static_cast<int>(p.x), static_cast<int>(p.y)});
+            }
+        }
+    }
+}
@@ -131,6 +131,17 @@ TEST_CASE("manhattan") {
     constexpr auto another = pos{20, 54};
     const auto sut = p.manhattan(another);
     CHECK_EQ(sut, std::abs(p.x - another.x) + std::abs(p.y - another.y));
+
+    constexpr pos<std::size_t> u{10, 15};
+    CHECK_EQ(u.manhattan(pos<std::size_t>{20, 4}), 21);
+    CHECK_EQ(pos<std::size_t>{20, 4}.manhattan(u), 21);
+}
+
+TEST_CASE("chebyshev") {
+    constexpr pos p{10, 15};
+    CHECK_EQ(p.chebyshev(pos{20, 54}), 39);
+    CHECK_EQ(p.chebyshev(pos{-10, 14}), 20);
+    CHECK_EQ(pos<std::size_t>{10, 15}.chebyshev(pos<std::size_t>{20, 4}), 11);
 }
 
 TEST_CASE("at") {
@@ -143,6 +154,13 @@ TEST_CASE("at") {
     CHECK_EQ(at(sut2, pos<>{0}), 'z');
 }
 
+TEST_CASE("hash") {
+    const std::hash<pos<int>> sut;
+    CHECK_EQ(sut(pos{1, 2}), sut(pos{1, 2}));
+    CHECK_NE(sut(pos{1, 2}), sut(pos{2, 1}));
+    CHECK_NE(sut(pos{0, 1}), sut(pos{1, 0}));
+}
+
 TEST_CASE("origin") {
     constexpr auto sut = origin();
     CHECK_EQ(sut.x, 0);
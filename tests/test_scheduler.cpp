@@ -0,0 +1,105 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "aoc.hpp"
+#include "doctest.h"
+
+using namespace aoc;
+
+TEST_CASE("event_scheduler") {
+    event_scheduler<std::string> events;
+    CHECK(events.empty());
+    events.schedule(5, "c");
+    events.schedule(2, "a");
+    events.schedule(5, "d");
+    events.schedule(2, "b");
+    events.schedule(1'000'000'000'000, "e");
+    CHECK_EQ(events.size(), 5);
+    CHECK_EQ(events.next_time(), 2);
+
+    CHECK_EQ(events.pop(), std::pair<std::uint64_t, std::string>{2, "a"});
+    CHECK_EQ(events.now(), 2);
+    events.schedule_after(0, "b2");
+    CHECK_EQ(events.pop().second, "b");
+    CHECK_EQ(events.pop().second, "b2");
+    CHECK_THROWS_AS(events.schedule(1, "late"), std::invalid_argument);
+
+    const auto batch = events.pop_batch();
+    CHECK_EQ(events.now(), 5);
+    CHECK_EQ(std::vector<std::string>(batch.begin(), batch.end()), std::vector<std::string>{"c", "d"});
+    CHECK_EQ(events.next_time(), 1'000'000'000'000);
+    CHECK_EQ(events.pop_batch().size(), 1);
+    CHECK_EQ(events.now(), 1'000'000'000'000);
+    CHECK(events.empty());
+
+    events.clear();
+    CHECK_EQ(events.now(), 0);
+}
+
+TEST_CASE("event_scheduler empty") {
+    event_scheduler<int> events;
+    CHECK_THROWS_AS(static_cast<void>(events.pop()), std::out_of_range);
+    CHECK_THROWS_AS(static_cast<void>(events.pop_batch()), std::out_of_range);
+    CHECK_THROWS_AS(static_cast<void>(events.next_time()), std::out_of_range);
+    events.schedule(3, 1);
+    static_cast<void>(events.pop());
+    CHECK_THROWS_AS(static_cast<void>(events.pop()), std::out_of_range);
+    CHECK_EQ(events.run([](std::uint64_t, int) {}), 0);
+}
+
+TEST_CASE("event_scheduler run") {
+    // each pulse travels one step down a chain of modules, with every third module also sending a pulse that goes nowhere
+    event_scheduler<int, std::uint32_t> pulses;
+    pulses.schedule(0, 0);
+    std::vector<std::pair<std::uint32_t, int>> seen;
+    const auto handled = pulses.run([&](std::uint32_t time, int module) {
+        seen.emplace_back(time, module);
+        if (module < 0 || module == 6)
+            return;
+        pulses.schedule_after(10, module + 1);
+        if (module % 3 == 0)
+            pulses.schedule_after(10, -module - 1);
+    }, 40);
+    CHECK_EQ(handled, 7);
+    CHECK_EQ(seen, std::vector<std::pair<std::uint32_t, int>>{{0, 0}, {10, 1}, {10, -1}, {20, 2}, {30, 3}, {40, 4}, {40, -4}});
+    CHECK_EQ(pulses.size(), 1);
+    CHECK_EQ(pulses.run([&](std::uint32_t, int module) { seen.emplace_back(0, module); }), 1);
+    CHECK_EQ(seen.back().second, 5);
+}
+
+TEST_CASE("event_scheduler matches a stable sort") {
+    std::mt19937_64 rng{50};
+    event_scheduler<std::size_t> events;
+    std::vector<std::pair<std::uint64_t, std::size_t>> pending;
+    std::size_t id = 0;
+    for (int round = 0; round < 2000; ++round) {
+        for (auto n = rng() % 4; n > 0; --n) {
+            const auto at = events.now() + (rng() % 3 == 0 ? rng() % 4 : rng() % (std::uint64_t{1} << (rng() % 40)));
+            events.schedule(at, id);
+            pending.emplace_back(at, id++);
+        }
+        if (pending.empty())
+            continue;
+        std::ranges::stable_sort(pending, {}, &std::pair<std::uint64_t, std::size_t>::first);
+        if (rng() % 2 == 0) {
+            REQUIRE_EQ(events.next_time(), pending.front().first);
+            REQUIRE_EQ(events.pop(), pending.front());
+            pending.erase(pending.begin());
+        } else {
+            const auto time = pending.front().first;
+            const auto batch = events.pop_batch();
+            REQUIRE_EQ(events.now(), time);
+            for (const auto event : batch) {
+                REQUIRE_EQ(pending.front(), std::pair{time, event});
+                pending.erase(pending.begin());
+            }
+            REQUIRE((pending.empty() || pending.front().first > time));
+        }
+        REQUIRE_EQ(events.size(), pending.size());
+    }
+}
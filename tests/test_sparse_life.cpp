@@ -0,0 +1,88 @@
+#include <random>
+#include <set>
+#include <vector>
+#include "aoc.hpp"
+#include "doctest.h"
+
+using namespace aoc;
+
+TEST_CASE("flat pos set") {
+    flat_pos_set<int> sut;
+    CHECK(sut.empty());
+    CHECK(sut.insert(pos{-3, 7}));
+    CHECK_FALSE(sut.insert(pos{-3, 7}));
+    CHECK(sut.contains(pos{-3, 7}));
+    CHECK_FALSE(sut.contains(pos{7, -3}));
+    CHECK_EQ(flat_pos_set<int>::unpack(flat_pos_set<int>::pack(pos{-2147483647 - 1, 2147483646})), pos{-2147483647 - 1, 2147483646});
+
+    // mirrors random inserts and erases into a std::set
+    std::set<pos<int>> expected{pos{-3, 7}};
+    std::mt19937 rng{17};
+    for (int i = 0; i < 20000; ++i) {
+        const pos p{static_cast<int>(rng() % 61) - 30, static_cast<int>(rng() % 61) - 30};
+        if (rng() % 3 == 0)
+            CHECK_EQ(sut.erase(p), expected.erase(p) == 1);
+        else
+            CHECK_EQ(sut.insert(p), expected.insert(p).second);
+    }
+    CHECK_EQ(sut.size(), expected.size());
+    std::set<pos<int>> actual;
+    sut.for_each([&actual](const pos<int>& p) { actual.insert(p); });
+    CHECK_EQ(actual, expected);
+    sut.clear();
+    CHECK(sut.empty());
+    CHECK_FALSE(sut.contains(pos{-3, 7}));
+}
+
+TEST_CASE("sparse life glider") {
+    sparse_life<int> sut;
+    for (const auto& p : {pos{1, 0}, pos{2, 1}, pos{0, 2}, pos{1, 2}, pos{2, 2}})
+        sut.set(p);
+    CHECK_EQ(sut.bounds(), area{2, 2, 0, 0});
+    CHECK(sut.step(4000));
+    CHECK_EQ(sut.population(), 5);
+    CHECK_EQ(sut.bounds(), area{1002, 1002, 1000, 1000});
+    CHECK(sut.test(pos{1001, 1000}));
+
+    sut.set(pos{-50, -60});
+    CHECK_EQ(sut.bounds(), area{1002, 1002, -50, -60});
+    sut.set(pos{-50, -60}, false);
+    CHECK_EQ(sut.bounds(), area{1002, 1002, 1000, 1000});
+    CHECK_THROWS_AS(sparse_life<int>{life_rule{"B0/S"}}, std::invalid_argument);
+}
+
+TEST_CASE("sparse life matches life") {
+    std::mt19937 rng{3};
+    life dense{60, 60};
+    sparse_life<long long> sut;
+    for (std::size_t y = 20; y < 40; ++y) {
+        for (std::size_t x = 20; x < 40; ++x) {
+            if (rng() % 3 == 0) {
+                dense.set(x, y);
+                sut.set(pos{static_cast<long long>(x) - 30, static_cast<long long>(y) - 30});
+            }
+        }
+    }
+    for (int generation = 0; generation < 10; ++generation) {
+        dense.step();
+        sut.step();
+        CHECK_EQ(sut.population(), dense.population());
+        bool same = true;
+        sut.cells().for_each([&](const pos<long long>& p) { same = same && dense.test(pos{p.x + 30, p.y + 30}); });
+        CHECK(same);
+    }
+}
+
+TEST_CASE("sparse life four") {
+    // with B1/S and edge neighbours, one cell grows into a diamond
+    sparse_life<int> sut{life_rule{"B1/S"}, connectivity::four};
+    sut.set(pos{0, 0});
+    CHECK(sut.step());
+    CHECK_EQ(sut.population(), 4);
+    CHECK_FALSE(sut.test(pos{0, 0}));
+    CHECK_EQ(sut.bounds(), area{1, 1, -1, -1});
+
+    sparse_life<int> empty;
+    CHECK_FALSE(empty.step(10));
+    CHECK_EQ(empty.bounds(), area{0});
+}
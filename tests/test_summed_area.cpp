@@ -0,0 +1,43 @@
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "aoc.hpp"
+#include "doctest.h"
+
+using namespace aoc;
+
+TEST_CASE("sum") {
+    grid<int> g{4, 3};
+    for (std::size_t y = 0; y < 3; ++y)
+        for (std::size_t x = 0; x < 4; ++x)
+            g.at(x, y) = static_cast<int>(y * 4 + x);
+    const summed_area_table sut1{g};
+    CHECK_EQ(sut1.sum(area<std::size_t>{3, 2}), 66);
+    CHECK_EQ(sut1.sum(area<std::size_t>{0, 0}), 0);
+    CHECK_EQ(sut1.sum(area<std::size_t>{2, 2, 1, 1}), 5 + 6 + 9 + 10);
+    CHECK_EQ(sut1.sum(area{10, 10, -5, -5}), 66);
+    CHECK_EQ(sut1.sum(area{-1, -1, -5, -5}), 0);
+    CHECK_EQ(sut1.sum(area{10, 10, 5, 0}), 0);
+
+    const auto lines = std::vector<std::string>{"#.#", "..#", "###"};
+    const summed_area_table<int> sut2{grid<char>::from_lines(lines), [](char c) { return c == '#'; }};
+    CHECK_EQ(sut2.sum(area<std::size_t>{2, 2}), 6);
+    CHECK_EQ(sut2.sum(area<std::size_t>{1, 1}), 1);
+    CHECK_EQ(sut2.sum(area<std::size_t>{2, 2, 2, 0}), 3);
+}
+
+TEST_CASE("max_sum_area") {
+    grid<int> g{4, 3, -1};
+    g.at(1, 0) = 3;
+    g.at(2, 0) = 2;
+    g.at(1, 1) = 4;
+    g.at(2, 1) = -1;
+    const auto sut1 = summed_area_table{g}.max_sum_area();
+    CHECK_EQ(sut1.sum, 8);
+    CHECK_EQ(sut1.bounds, area<std::size_t>{2, 1, 1, 0});
+
+    const auto sut2 = summed_area_table{grid<int>{3, 3, -2}}.max_sum_area();
+    CHECK_EQ(sut2.sum, -2);
+
+    CHECK_THROWS_AS(static_cast<void>(summed_area_table{grid<int>{}}.max_sum_area()), std::out_of_range);
+}
@@ -0,0 +1,139 @@
+#include <cstddef>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include "aoc.hpp"
+#include "doctest.h"
+
+using namespace aoc;
+
+namespace {
+    grid<char> platform() {
+        return grid<char>::from_lines(std::vector<std::string>{
+            "O....#....",
+            "O.OO#....#",
+            ".....##...",
+            "OO.#O....O",
+            ".O.....O#.",
+            "O.#..O.#.#",
+            "..O..#O..O",
+            ".......O..",
+            "#....###..",
+            "#OO..#....",
+        });
+    }
+
+    std::size_t load(const grid<char>& g) {
+        std::size_t result = 0;
+        for (std::size_t y = 0; y < g.height(); ++y)
+            for (std::size_t x = 0; x < g.width(); ++x)
+                result += g.at(x, y) == 'O' ? g.height() - y : 0;
+        return result;
+    }
+
+    std::size_t load(const tilt_board& board) {
+        std::size_t result = 0;
+        board.for_each([&](const pos<std::size_t>& p) { result += board.height() - p.y; });
+        return result;
+    }
+
+    void spin(grid<char>& g) {
+        for (const auto dir : {direction::north, direction::west, direction::south, direction::east})
+            tilt(g, dir, 'O', '.');
+    }
+
+    void spin(tilt_board& board) {
+        for (const auto dir : {direction::north, direction::west, direction::south, direction::east})
+            board.tilt(dir);
+    }
+}
+
+TEST_CASE("tilt") {
+    auto g = platform();
+    tilt(g, direction::north, 'O', '.');
+    CHECK_EQ(load(g), 136);
+    CHECK_EQ(g, grid<char>::from_lines(std::vector<std::string>{
+        "OOOO.#.O..",
+        "OO..#....#",
+        "OO..O##..O",
+        "O..#.OO...",
+        "........#.",
+        "..#....#.#",
+        "..O..#.O.O",
+        "..O.......",
+        "#....###..",
+        "#....#....",
+    }));
+
+    g = platform();
+    spin(g);
+    CHECK_EQ(g, grid<char>::from_lines(std::vector<std::string>{
+        ".....#....",
+        "....#...O#",
+        "...OO##...",
+        ".OO#......",
+        ".....OOO#.",
+        ".O#...O#.#",
+        "....O#....",
+        "......OOOO",
+        "#...O###..",
+        "#..OO#....",
+    }));
+
+    const auto spun = simulate(platform(), 1'000'000'000, [](grid<char>& state) { spin(state); });
+    CHECK_EQ(load(spun), 64);
+}
+
+TEST_CASE("tilt_board") {
+    auto board = tilt_board::from_grid(platform(), 'O', '.');
+    CHECK_EQ(board.width(), 10);
+    CHECK_EQ(board.height(), 10);
+    CHECK_EQ(board.count(), 18);
+    CHECK(board.test(0, 0));
+    CHECK(board.blocked(5, 0));
+    CHECK_FALSE(board.test(1, 0));
+
+    board.tilt(direction::north);
+    CHECK_EQ(load(board), 136);
+    CHECK(board.test(3, 0));
+    CHECK_EQ(board.count(), 18);
+
+    auto expected = platform();
+    spin(expected);
+    auto spun = tilt_board::from_grid(platform(), 'O', '.');
+    spin(spun);
+    CHECK_EQ(spun, tilt_board::from_grid(expected, 'O', '.'));
+    CHECK_EQ(std::hash<tilt_board>{}(spun), tilt_board::from_grid(expected, 'O', '.').hash());
+
+    const auto cycled = simulate(tilt_board::from_grid(platform(), 'O', '.'), 1'000'000'000, [](tilt_board& state) { spin(state); }, cycle_memory::hashes);
+    CHECK_EQ(load(cycled), 64);
+
+    tilt_board empty{3, 2};
+    empty.set(1, 1);
+    empty.tilt(direction::south);
+    CHECK(empty.test(1, 1));
+    empty.tilt(direction::west);
+    CHECK(empty.test(0, 1));
+    empty.set(0, 1, false);
+    CHECK_EQ(empty.count(), 0);
+}
+
+TEST_CASE("tilt_board matches tilt") {
+    std::mt19937 rng{47};
+    for (const auto& [width, height] : {std::pair<std::size_t, std::size_t>{1, 1}, {64, 64}, {70, 130}, {200, 3}, {5, 129}}) {
+        grid<char> g{width, height};
+        for (auto& c : g)
+            c = ".O#"[rng() % 3];
+        auto board = tilt_board::from_grid(g, 'O', '.');
+        for (int i = 0; i < 12; ++i) {
+            const auto dir = static_cast<direction>(rng() % 4);
+            tilt(g, dir, 'O', '.');
+            board.tilt(dir);
+            REQUIRE_EQ(board, tilt_board::from_grid(g, 'O', '.'));
+            for (std::size_t y = 0; y < height; ++y)
+                for (std::size_t x = 0; x < width; ++x)
+                    REQUIRE_EQ(board.test(x, y), (g.at(x, y) == 'O'));
+        }
+    }
+}
@@ -0,0 +1,64 @@
+#include <cstdint>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "aoc.hpp"
+#include "doctest.h"
+
+using namespace aoc;
+
+TEST_CASE("fast_mod") {
+    CHECK_THROWS_AS(fast_mod{0}, std::invalid_argument);
+
+    for (const std::uint32_t d : {1U, 2U, 3U, 7U, 10U, 131U, 1000U, 65537U, 4294967295U}) {
+        const fast_mod sut{d};
+        for (const std::uint32_t v : {0U, 1U, 2U, 9U, 130U, 131U, 132U, 99999U, 4294967294U, 4294967295U})
+            CHECK_EQ(sut.reduce(v), v % d);
+        for (const long long v : {-1LL, -2LL, -131LL, -132LL, -4294967296LL, -4294967297LL, 4294967296LL, 1LL << 40, -(1LL << 40)})
+            CHECK_EQ(sut(v), ((v % d) + d) % d);
+    }
+
+    const fast_mod sut{10};
+    CHECK_EQ(sut(-7), 3);
+    CHECK_EQ(sut(-20), 0);
+    CHECK_EQ(sut(std::size_t{0} - 1), 9);
+    CHECK_EQ(sut(std::size_t{0} - 13), 7);
+    CHECK_EQ(sut(std::size_t{25}), 5);
+}
+
+TEST_CASE("torus") {
+    const torus<int> sut1{area{4, 2, -1, 0}};
+    CHECK_EQ(sut1.wrap(pos{0, 1}), pos{0, 1});
+    CHECK_EQ(sut1.wrap(pos{5, 3}), pos{-1, 0});
+    CHECK_EQ(sut1.wrap(pos{-2, -1}), pos{4, 2});
+    CHECK_EQ(sut1.wrap(pos{-13, 100}), pos{-1, 1});
+
+    const torus<std::size_t> sut2{area<std::size_t>{9, 4}};
+    const auto n = sut2.neighbours(pos<std::size_t>{0});
+    CHECK_NE(std::ranges::find(n, pos<std::size_t>{9, 0}), std::ranges::end(n));
+    CHECK_NE(std::ranges::find(n, pos<std::size_t>{0, 4}), std::ranges::end(n));
+    CHECK_NE(std::ranges::find(n, pos<std::size_t>{1, 0}), std::ranges::end(n));
+    CHECK_NE(std::ranges::find(n, pos<std::size_t>{0, 1}), std::ranges::end(n));
+
+    const auto d = sut2.neighbours_diag(pos<std::size_t>{9, 4});
+    CHECK_NE(std::ranges::find(d, pos<std::size_t>{0, 0}), std::ranges::end(d));
+    CHECK_NE(std::ranges::find(d, pos<std::size_t>{8, 3}), std::ranges::end(d));
+}
+
+TEST_CASE("torus_view") {
+    auto g = grid<char>::from_lines(std::vector<std::string>{"abc", "def"});
+    const torus_view sut{g};
+    CHECK_EQ(sut.at(pos{0, 0}), 'a');
+    CHECK_EQ(sut.at(pos{3, 0}), 'a');
+    CHECK_EQ(sut.at(pos{-1, 0}), 'c');
+    CHECK_EQ(sut[pos{-1, -1}], 'f');
+    CHECK_EQ(sut[pos{-302, 7}], 'e');
+
+    sut.at(pos<long>{4, 2}) = 'z';
+    CHECK_EQ(g.at(1, 0), 'z');
+
+    const auto n = sut.neighbours(pos{0, 0});
+    CHECK_NE(std::ranges::find(n, pos{2, 0}), std::ranges::end(n));
+    CHECK_NE(std::ranges::find(n, pos{0, 1}), std::ranges::end(n));
+}
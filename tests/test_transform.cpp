@@ -0,0 +1,111 @@
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "aoc.hpp"
+#include "doctest.h"
+
+using namespace aoc;
+
+namespace {
+    template <typename T, typename Layout = row_major>
+    grid<T, Layout> numbered(std::size_t width, std::size_t height) {
+        grid<T, Layout> result{width, height};
+        for (std::size_t y = 0; y < height; ++y)
+            for (std::size_t x = 0; x < width; ++x)
+                result.at(x, y) = static_cast<T>(y * width + x);
+        return result;
+    }
+}
+
+TEST_CASE("transpose") {
+    for (const auto& [w, h] : {std::pair{1, 1}, std::pair{8, 8}, std::pair{13, 21}, std::pair{40, 17}, std::pair{64, 3}}) {
+        const auto g1 = numbered<char>(w, h);
+        const auto sut1 = transpose(g1);
+        const auto g2 = numbered<int, tiled<2>>(w, h);
+        const auto sut2 = transpose(g2);
+        REQUIRE_EQ(sut1.width(), h);
+        REQUIRE_EQ(sut1.height(), w);
+        for (std::size_t y = 0; y < static_cast<std::size_t>(h); ++y) {
+            for (std::size_t x = 0; x < static_cast<std::size_t>(w); ++x) {
+                CHECK_EQ(sut1.at(y, x), g1.at(x, y));
+                CHECK_EQ(sut2.at(y, x), g2.at(x, y));
+            }
+        }
+        CHECK_EQ(transpose(sut1), g1);
+    }
+
+    const std::vector<std::string> lines{"abcdefghij", "klmnopqrst", "uvwxyz0123"};
+    const auto sut3 = transpose(lines);
+    CHECK_EQ(sut3.size(), 10);
+    CHECK_EQ(sut3[0], "aku");
+    CHECK_EQ(sut3[9], "jt3");
+    CHECK_EQ(transpose(sut3), lines);
+    CHECK_THROWS_AS(static_cast<void>(transpose(std::vector<std::string>{"ab", "c"})), std::invalid_argument);
+}
+
+TEST_CASE("transpose_in_place") {
+    auto sut = numbered<int>(37, 37);
+    transpose_in_place(sut);
+    CHECK_EQ(sut, transpose(numbered<int>(37, 37)));
+
+    auto g = numbered<int>(2, 3);
+    CHECK_THROWS_AS(transpose_in_place(g), std::invalid_argument);
+}
+
+TEST_CASE("rotate") {
+    const std::vector<std::string> lines{"abc", "def"};
+    CHECK_EQ(rotate_cw(lines), std::vector<std::string>{"da", "eb", "fc"});
+    CHECK_EQ(rotate_ccw(lines), std::vector<std::string>{"cf", "be", "ad"});
+    CHECK_EQ(rotate_180(lines), std::vector<std::string>{"fed", "cba"});
+    CHECK_EQ(flip_x(lines), std::vector<std::string>{"cba", "fed"});
+    CHECK_EQ(flip_y(lines), std::vector<std::string>{"def", "abc"});
+
+    const auto g = grid<char>::from_lines(lines);
+    CHECK_EQ(rotate_cw(g), grid<char>::from_lines(rotate_cw(lines)));
+    CHECK_EQ(rotate_ccw(g), grid<char>::from_lines(rotate_ccw(lines)));
+    CHECK_EQ(rotate_180(g), grid<char>::from_lines(rotate_180(lines)));
+    CHECK_EQ(flip_x(g), grid<char>::from_lines(flip_x(lines)));
+    CHECK_EQ(flip_y(g), grid<char>::from_lines(flip_y(lines)));
+
+    const auto t = tiled_grid<char>::from_lines(lines);
+    CHECK_EQ(rotate_cw(t), tiled_grid<char>::from_lines(rotate_cw(lines)));
+    CHECK_EQ(rotate_180(t), tiled_grid<char>::from_lines(rotate_180(lines)));
+}
+
+TEST_CASE("rotate_in_place") {
+    const auto g = numbered<int>(9, 9);
+    auto sut = g;
+    rotate_cw_in_place(sut);
+    CHECK_EQ(sut, rotate_cw(g));
+    rotate_ccw_in_place(sut);
+    CHECK_EQ(sut, g);
+    rotate_180_in_place(sut);
+    CHECK_EQ(sut, rotate_180(g));
+    flip_x_in_place(sut);
+    flip_y_in_place(sut);
+    CHECK_EQ(sut, g);
+}
+
+TEST_CASE("rotated_view") {
+    const auto g = grid<char>::from_lines(std::vector<std::string>{"abc", "def"});
+    for (int turns = -1; turns <= 4; ++turns) {
+        for (const bool flipped : {false, true}) {
+            auto expected = g;
+            for (int i = 0; i < (turns % 4 + 4) % 4; ++i)
+                expected = rotate_cw(expected);
+            if (flipped)
+                expected = flip_x(expected);
+
+            const rotated_view sut{g, turns, flipped};
+            REQUIRE_EQ(sut.width(), expected.width());
+            REQUIRE_EQ(sut.height(), expected.height());
+            for (std::size_t y = 0; y < sut.height(); ++y)
+                for (std::size_t x = 0; x < sut.width(); ++x)
+                    CHECK_EQ(sut[pos{x, y}], expected.at(x, y));
+        }
+    }
+
+    auto m = g;
+    rotated_view{m}.at(0, 0) = 'z';
+    CHECK_EQ(m.at(0, 1), 'z');
+}
@@ -0,0 +1,23 @@
+#include "aoc.hpp"
+#include "doctest.h"
+
+using namespace aoc;
+
+TEST_CASE("union_find") {
+    union_find sut{6};
+    CHECK_EQ(sut.size(), 6);
+    CHECK_EQ(sut.sets(), 6);
+    CHECK(sut.unite(0, 1));
+    CHECK(sut.unite(2, 3));
+    CHECK(sut.unite(1, 3));
+    CHECK_FALSE(sut.unite(0, 2));
+    CHECK_EQ(sut.sets(), 3);
+    CHECK(sut.same(0, 3));
+    CHECK_FALSE(sut.same(0, 4));
+    CHECK_EQ(sut.set_size(2), 4);
+    CHECK_EQ(sut.set_size(5), 1);
+
+    sut.reset(3);
+    CHECK_EQ(sut.sets(), 3);
+    CHECK_FALSE(sut.same(0, 1));
+}
@@ -0,0 +1,77 @@
+#include <cstdint>
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include "aoc.hpp"
+#include "doctest.h"
+
+using namespace aoc;
+
+TEST_CASE("zobrist key") {
+    const zobrist<char> sut;
+    CHECK_EQ(sut.key(3, '#'), zobrist<char>{}.key(3, '#'));
+    CHECK_NE(sut.key(3, '#'), sut.key(4, '#'));
+    CHECK_NE(sut.key(3, '#'), sut.key(3, '.'));
+    CHECK_NE(sut.key(3, '#'), zobrist<char>{7}.key(3, '#'));
+}
+
+TEST_CASE("zobrist grid set") {
+    zobrist_grid<char> sut{4, 3, '.'};
+    CHECK_EQ(sut.width(), 4);
+    CHECK_EQ(sut.height(), 3);
+    CHECK_EQ(sut.hash(), sut.rehash());
+    const auto empty = sut.hash();
+
+    sut.set(pos{1, 2}, '#');
+    CHECK_EQ(sut[pos{1, 2}], '#');
+    CHECK_EQ(sut.at(1, 2), '#');
+    CHECK_NE(sut.hash(), empty);
+    CHECK_EQ(sut.hash(), sut.rehash());
+    sut.set(1, 2, '.');
+    CHECK_EQ(sut.hash(), empty);
+
+    sut.set(pos{0, 0}, 'O');
+    const auto before = sut.hash();
+    sut.swap(pos{0, 0}, pos{3, 2});
+    CHECK_EQ(sut.at(3, 2), 'O');
+    CHECK_EQ(sut.at(0, 0), '.');
+    CHECK_NE(sut.hash(), before);
+    CHECK_EQ(sut.hash(), sut.rehash());
+    sut.swap(pos{0, 0}, pos{0, 0});
+    CHECK_EQ(sut.hash(), sut.rehash());
+}
+
+TEST_CASE("zobrist grid equality") {
+    const auto lines = std::vector<std::string>{"O.#", ".O.", "#.O"};
+    zobrist_grid a{grid<char>::from_lines(lines)};
+    zobrist_grid b{grid<char>::from_lines(lines)};
+    zobrist_grid<char, tiled<>> tiledGrid{grid<char, tiled<>>::from_lines(lines)};
+    CHECK_EQ(a, b);
+    CHECK_EQ(a.hash(), tiledGrid.hash());
+    CHECK_EQ(a.base(), grid<char>::from_lines(lines));
+
+    b.swap(pos{0, 0}, pos{1, 0});
+    CHECK_NE(a, b);
+    std::unordered_set<zobrist_grid<char>> seen{a, b};
+    CHECK_EQ(seen.size(), 2);
+    b.swap(pos{0, 0}, pos{1, 0});
+    CHECK_FALSE(seen.insert(b).second);
+    CHECK_EQ(state_hash{}(a), a.hash());
+}
+
+TEST_CASE("zobrist grid simulate") {
+    // a rock rolling east along a ring track is back after every lap
+    const auto roll = [](zobrist_grid<char>& g) {
+        for (std::size_t x = 0; x < g.width(); ++x) {
+            if (g.at(x, 0) == 'O') {
+                g.swap(pos{x, std::size_t{0}}, pos{(x + 1) % g.width(), std::size_t{0}});
+                return;
+            }
+        }
+    };
+    zobrist_grid<char> start{5, 1, '.'};
+    start.set(pos{0, 0}, 'O');
+    const auto sut = simulate(start, 1000000002, roll, cycle_memory::hashes);
+    CHECK_EQ(sut.at(2, 0), 'O');
+    CHECK_EQ(sut.hash(), sut.rehash());
+}